@@ -163,6 +163,33 @@ namespace picongpu
         template<uint32_t AREA, class FrameSolver, typename Filter = particles::filter::All, class ParticlesClass>
         HINLINE void computeValue(ParticlesClass& parClass, uint32_t currentStep);
 
+        /** Compute several derived species properties in one pass over the particles
+         *
+         * Each selected solver deposits into its own temporary field slot, the
+         * slots 0 to N-1 are used and must be reset by the caller.
+         * In contrast to computeValue() the particle frames are read only once for
+         * all solvers.
+         *
+         * @tparam AREA area to compute the values in
+         * @tparam T_FrameSolvers sequence of frame solvers
+         * @tparam Filter particle filter used to filter contributing particles
+         *         (default is all particles contribute)
+         *
+         * @param parClass particle species
+         * @param currentStep index of time iteration
+         * @param solverSlots slot of each solver in T_FrameSolvers, -1 to skip the solver,
+         *                    the used slots must be consecutive and start at 0
+         */
+        template<
+            uint32_t AREA,
+            typename T_FrameSolvers,
+            typename Filter = particles::filter::All,
+            class ParticlesClass>
+        HINLINE static void computeValues(
+            ParticlesClass& parClass,
+            uint32_t currentStep,
+            std::vector<int> const& solverSlots);
+
         /** Bash particles in a direction.
          * Copy all particles from the guard of a direction to the device exchange buffer
          *
@@ -35,15 +35,19 @@
 #include <pmacc/fields/tasks/FieldFactory.hpp>
 #include <pmacc/mappings/simulation/GridController.hpp>
 #include <pmacc/math/Vector.hpp>
+#include <pmacc/memory/Array.hpp>
 #include <pmacc/memory/buffers/GridBuffer.hpp>
 #include <pmacc/particles/traits/FilterByFlag.hpp>
 #include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/traits/GetUniqueTypeId.hpp>
 
 #include <boost/mpl/accumulate.hpp>
+#include <boost/mpl/size.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <string>
+#include <vector>
 
 
 namespace picongpu
@@ -186,6 +190,61 @@ namespace picongpu
     }
 
 
+    template<uint32_t AREA, typename T_FrameSolvers, typename Filter, class ParticlesClass>
+    void FieldTmp::computeValues(ParticlesClass& parClass, uint32_t currentStep, std::vector<int> const& solverSlots)
+    {
+        PMACC_CASSERT_MSG(_please_allocate_at_least_one_FieldTmp_in_memory_param, fieldTmpNumSlots > 0);
+
+        constexpr uint32_t numSolvers = bmpl::size<T_FrameSolvers>::type::value;
+        // the shared memory cache holds one component per slot, do not reserve more than can be used
+        constexpr uint32_t numSlots = std::min(numSolvers, fieldTmpNumSlots);
+
+        PMACC_VERIFY_MSG(solverSlots.size() == numSolvers, "FieldTmp: one slot per solver required");
+
+        memory::Array<int, numSolvers> slots;
+        uint32_t numUsedSlots = 0u;
+        for(uint32_t i = 0u; i < numSolvers; ++i)
+        {
+            slots[i] = solverSlots[i];
+            PMACC_VERIFY_MSG(slots[i] < static_cast<int>(numSlots), "FieldTmp: not enough FieldTmp slots available");
+            if(slots[i] >= 0)
+                numUsedSlots = std::max(numUsedSlots, static_cast<uint32_t>(slots[i] + 1));
+        }
+
+        if(numUsedSlots == 0u)
+            return;
+
+        DataConnector& dc = Environment<>::get().DataConnector();
+        memory::Array<FieldTmp::DataBoxType, numSlots> tmpBoxes;
+        for(uint32_t slot = 0u; slot < numUsedSlots; ++slot)
+            tmpBoxes[slot] = dc.get<FieldTmp>(FieldTmp::getUniqueId(slot), true)->getDeviceDataBox();
+
+        using LowerMargin = typename bmpl::accumulate<
+            T_FrameSolvers,
+            typename pmacc::math::CT::make_Int<simDim, 0>::type,
+            pmacc::math::CT::max<bmpl::_1, GetLowerMargin<bmpl::_2>>>::type;
+
+        using UpperMargin = typename bmpl::accumulate<
+            T_FrameSolvers,
+            typename pmacc::math::CT::make_Int<simDim, 0>::type,
+            pmacc::math::CT::max<bmpl::_1, GetUpperMargin<bmpl::_2>>>::type;
+
+        using BlockArea = SuperCellDescription<typename MappingDesc::SuperCellSize, LowerMargin, UpperMargin>;
+
+        MappingDesc const cellDescription = dc.get<FieldTmp>(FieldTmp::getUniqueId(0), true)->getCellDescription();
+        auto mapper = makeStrideAreaMapper<AREA, 3>(cellDescription);
+        typename ParticlesClass::ParticlesBoxType pBox = parClass.getDeviceParticlesBox();
+        using ParticleFilter = typename Filter ::template apply<ParticlesClass>::type;
+        auto iFilter = particles::filter::IUnary<ParticleFilter>{currentStep};
+        constexpr uint32_t numWorkers
+            = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
+        do
+        {
+            PMACC_KERNEL(KernelComputeSupercellsBatch<numWorkers, BlockArea, T_FrameSolvers, numSlots>{})
+            (mapper.getGridDim(), numWorkers)(tmpBoxes, pBox, slots, numUsedSlots, iFilter, mapper);
+        } while(mapper.next());
+    }
+
     SimulationDataId FieldTmp::getUniqueId(uint32_t slotId)
     {
         return getName() + std::to_string(slotId);
@@ -56,7 +56,14 @@ namespace picongpu
                 using CurlE = T_CurlE;
                 using CurlB = T_CurlB;
 
-                FDTD(MappingDesc const cellDescription) : cellDescription(cellDescription)
+                /** Create an FDTD solver instance
+                 *
+                 * @param cellDescription mapping for kernels
+                 * @param temporalBlocking try to update B and E in the core by a single pass,
+                 *                         see isTemporalBlockingSupported()
+                 */
+                FDTD(MappingDesc const cellDescription, bool const temporalBlocking = false)
+                    : cellDescription(cellDescription)
                 {
                     LaserChecker<FDTD>{}();
                     DataConnector& dc = Environment<>::get().DataConnector();
@@ -64,6 +71,31 @@ namespace picongpu
                     fieldB = dc.get<FieldB>(FieldB::getName(), true);
                     auto& absorberFactory = fields::absorber::AbsorberFactory::get();
                     absorberImpl = absorberFactory.makeImpl(cellDescription);
+                    if(temporalBlocking)
+                    {
+                        useTemporalBlocking = isTemporalBlockingSupported();
+                        if(!useTemporalBlocking)
+                            log<picLog::PHYSICS>(
+                                "FDTD: temporal blocking requires curls without lower margin for E and upper margin "
+                                "for B (e.g. Yee) and no incident field, using the regular update");
+                    }
+                }
+
+                /** Check if the current configuration supports temporal blocking
+                 *
+                 * With temporal blocking, the second half of the B update and the E update in the core are done
+                 * by a single kernel pass in place.
+                 * This requires the curl of E to only use values at the same or larger indices, and the curl of B
+                 * to only use values at the same or smaller indices, as it is the case for the Yee solver.
+                 * The incident field solver adds its contribution to B between the two updates, so it must be
+                 * disabled.
+                 */
+                static bool isTemporalBlockingSupported()
+                {
+                    // Margins are non-negative, so a zero sum means no margin along all axes
+                    bool const isCurlEForward = traits::GetLowerMargin<CurlE>::type::toRT().sumOfComponents() == 0;
+                    bool const isCurlBBackward = traits::GetUpperMargin<CurlB>::type::toRT().sumOfComponents() == 0;
+                    return isCurlEForward && isCurlBBackward && !incidentField::Solver::isEnabled();
                 }
 
                 /** Perform the first part of E and B propagation by a time step.
@@ -82,6 +114,20 @@ namespace picongpu
                      * For PML there is a difference, it is treated inside the absorber implementation.
                      * In both cases, the full E and B fields behave as expected after the update.
                      */
+                    if(useTemporalBlocking)
+                    {
+                        updateBSecondHalf<BORDER>(currentStep);
+                        EventTask eRfieldB = fieldB->asyncCommunication(__getTransactionEvent());
+
+                        /* The core update reads E at the border which is not updated yet and B at the border which
+                         * is already updated, as required for the wavefront order.
+                         */
+                        updateBSecondHalfAndE<CORE>(currentStep);
+                        __setTransactionEvent(eRfieldB);
+                        updateE<BORDER>(currentStep);
+                        return;
+                    }
+
                     updateBSecondHalf<CORE + BORDER>(currentStep);
                     auto incidentFieldSolver = fields::incidentField::Solver{cellDescription};
                     // update B by half step, to step = currentStep + 0.5, so step for E_inc = currentStep
@@ -256,6 +302,75 @@ namespace picongpu
                     }
                 }
 
+                /** Propagate B values in the given area by the second half of a time step and then E values by a
+                 * time step
+                 *
+                 * The result is the same as for updateBSecondHalf() followed by updateE(), but each supercell is
+                 * processed by a single pass.
+                 * The supercells are processed in wavefronts by one kernel call each, so this is meant for large
+                 * areas on CPUs where the field solver is memory bound.
+                 * Must only be used if isTemporalBlockingSupported().
+                 * Supercells at the upper side of the area are read with E values of the old time step,
+                 * supercells at the lower side are read with B values of the new time step.
+                 *
+                 * @tparam T_Area area to apply updates to, the curl must be applicable to all points;
+                 *                normally CORE
+                 *
+                 * @param currentStep index of the current time iteration
+                 */
+                template<uint32_t T_Area>
+                void updateBSecondHalfAndE(uint32_t const currentStep)
+                {
+                    constexpr auto numWorkers = getNumWorkers();
+                    using Kernel = fdtd::KernelUpdateBHalfAndE<numWorkers>;
+                    auto const mapper = pmacc::makeAreaMapper<T_Area>(cellDescription);
+                    auto const numSuperCells = mapper.getGridDim();
+                    for(uint32_t d = 0; d < simDim; ++d)
+                        if(numSuperCells[d] <= 0)
+                            return;
+                    // One block for each supercell of a wavefront, its index along the last axis is determined
+                    auto gridDim = numSuperCells;
+                    gridDim[simDim - 1] = 1;
+                    int const numWavefronts = numSuperCells.sumOfComponents() - static_cast<int>(simDim) + 1;
+
+                    // The ugly transition from run-time to compile-time polymorphism is contained here
+                    auto& absorber = absorber::Absorber::get();
+                    if(absorber.getKind() == absorber::Absorber::Kind::Pml)
+                    {
+                        auto& pmlImpl = absorberImpl->asPmlImpl();
+                        auto const updateBFunctor
+                            = pmlImpl.getUpdateBHalfFunctor<CurlE, T_Area>(currentStep, false);
+                        auto const updateEFunctor = pmlImpl.getUpdateEFunctor<CurlB, T_Area>(currentStep);
+                        for(int wavefrontIdx = 0; wavefrontIdx < numWavefronts; ++wavefrontIdx)
+                        {
+                            PMACC_KERNEL(Kernel{})
+                            (gridDim, numWorkers)(
+                                mapper,
+                                numSuperCells,
+                                wavefrontIdx,
+                                updateBFunctor,
+                                updateEFunctor,
+                                fieldE->getDeviceDataBox(),
+                                fieldB->getDeviceDataBox());
+                        }
+                    }
+                    else
+                    {
+                        for(int wavefrontIdx = 0; wavefrontIdx < numWavefronts; ++wavefrontIdx)
+                        {
+                            PMACC_KERNEL(Kernel{})
+                            (gridDim, numWorkers)(
+                                mapper,
+                                numSuperCells,
+                                wavefrontIdx,
+                                fdtd::UpdateBHalfFunctor<CurlE>{},
+                                fdtd::UpdateEFunctor<CurlB>{},
+                                fieldE->getDeviceDataBox(),
+                                fieldB->getDeviceDataBox());
+                        }
+                    }
+                }
+
                 //! Get number of workers for kernels
                 static constexpr uint32_t getNumWorkers()
                 {
@@ -268,6 +383,9 @@ namespace picongpu
 
                 // Absorber implementation
                 std::unique_ptr<fields::absorber::AbsorberImpl> absorberImpl;
+
+                //! Whether B and E in the core are updated by a single pass in update_beforeCurrent()
+                bool useTemporalBlocking = false;
             };
 
         } // namespace maxwellSolver
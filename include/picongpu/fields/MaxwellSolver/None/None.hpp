@@ -43,7 +43,7 @@ namespace picongpu
             public:
                 using CellType = cellType::Yee;
 
-                None(MappingDesc)
+                None(MappingDesc, bool = false)
                 {
                     LaserChecker<None>{}();
                 }
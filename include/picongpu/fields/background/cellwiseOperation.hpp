@@ -126,15 +126,23 @@ namespace picongpu
             void operator()(T_Field field, T_OpFunctor opFunctor, T_ValFunctor valFunctor, uint32_t const currentStep)
                 const
             {
-                SubGrid<simDim> const& subGrid = Environment<simDim>::get().SubGrid();
-                // offset to the local domain relative to the origin of the global domain
-                DataSpace<simDim> totalDomainOffset(subGrid.getLocalDomain().offset);
-                uint32_t const numSlides = MovingWindow::getInstance().getSlideCounter(currentStep);
+                applyToBox(field->getDeviceDataBox(), opFunctor, valFunctor, currentStep);
+            }
 
-                /** Assumption: all GPUs have the same number of cells in
-                 *              y direction for sliding window
-                 */
-                totalDomainOffset.y() += numSlides * subGrid.getLocalDomain().size.y();
+            /** Execute the op/valFunctor on a data box with the layout of a field including guards
+             *
+             * @tparam ValFunctor A Value-Producing functor for a given cell
+             *                    in time and space
+             * @tparam OpFunctor A manipulating functor like pmacc::math::operation::*
+             */
+            template<typename T_FieldBox, typename T_OpFunctor, typename T_ValFunctor>
+            void applyToBox(
+                T_FieldBox fieldBox,
+                T_OpFunctor opFunctor,
+                T_ValFunctor valFunctor,
+                uint32_t const currentStep) const
+            {
+                DataSpace<simDim> const totalDomainOffset = getTotalDomainOffset(currentStep);
 
                 constexpr uint32_t numWorkers
                     = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
@@ -143,7 +151,27 @@ namespace picongpu
 
                 PMACC_KERNEL(KernelCellwiseOperation<numWorkers>{})
                 (mapper.getGridDim(),
-                 numWorkers)(field->getDeviceDataBox(), opFunctor, valFunctor, totalDomainOffset, currentStep, mapper);
+                 numWorkers)(fieldBox, opFunctor, valFunctor, totalDomainOffset, currentStep, mapper);
+            }
+
+            /** Get the offset to the local domain relative to the origin of the global domain
+             *
+             * The offset includes the slides of the moving window.
+             *
+             * @param currentStep simulation time step
+             */
+            static DataSpace<simDim> getTotalDomainOffset(uint32_t const currentStep)
+            {
+                SubGrid<simDim> const& subGrid = Environment<simDim>::get().SubGrid();
+                // offset to the local domain relative to the origin of the global domain
+                DataSpace<simDim> totalDomainOffset(subGrid.getLocalDomain().offset);
+                uint32_t const numSlides = MovingWindow::getInstance().getSlideCounter(currentStep);
+
+                /** Assumption: all GPUs have the same number of cells in
+                 *              y direction for sliding window
+                 */
+                totalDomainOffset.y() += numSlides * subGrid.getLocalDomain().size.y();
+                return totalDomainOffset;
             }
         };
 
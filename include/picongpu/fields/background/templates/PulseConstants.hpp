@@ -0,0 +1,145 @@
+/* Copyright 2014-2021 Alexander Debus, Axel Huebl
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/types.hpp>
+
+namespace picongpu
+{
+    namespace templates
+    {
+        namespace detail
+        {
+            /** Position and time independent quantities of the TWTS laser pulse
+             *
+             * Shared by the twts and twtsfast background fields.
+             * The field functions are evaluated for each field component of each cell.
+             * All terms which only depend on the laser parameters, in particular the
+             * transcendental functions of the tilt angle, are calculated once on the host.
+             * They are stored as float_X, hence the fields can differ from an evaluation of the full
+             * expressions per cell at the level of float_X rounding.
+             */
+            struct PulseConstants
+            {
+                using float_T = float_X;
+
+                /** Laser pulse front tilt angle [rad]
+                 *
+                 * For beta0=1.0, this is equivalent to our standard definition. Question: Why is the
+                 * "phi_T" not equal in value to the object member "phiReal" or "phi"?
+                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
+                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
+                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
+                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
+                 * scenarios close to beta0 = 1.
+                 */
+                float_T phiT;
+                /** Shortcuts of the tilt angle: sin(phiT), cos(phiT), 1/sin(phiT),
+                 *  sin(phiT/2), cos(phiT/2), 1/cos(phiT/2), tan(phiT/2), sin(2*phiT) and tan(PI/2-phiT)
+                 */
+                float_T sinPhi;
+                float_T cosPhi;
+                float_T cscPhi;
+                float_T sinPhi2;
+                float_T cosPhi2;
+                float_T secPhi2;
+                float_T tanPhi2;
+                float_T sin2Phi;
+                float_T tanPI2_phi;
+                /** Normalized speed of light */
+                float_T cspeed;
+                /** Central angular frequency */
+                float_T om0;
+                /** Pulse duration, factor 2 arises from definition convention in laser formula */
+                float_T tauG;
+                /** Rayleigh length of the line focus, based on w0 = wx */
+                float_T rho0;
+                /** Central wave number */
+                float_T k;
+                /** Shift of time [second] and position [meter] by one period of the laser pulse
+                 *
+                 * Used by twtsfast to evaluate the field in single precision within a finite coordinate range.
+                 */
+                float_64 deltaT;
+                float_64 deltaY;
+                float_64 deltaZ;
+                /** sin(phi) and cos(phi) of the interaction angle for rotating back the field vectors */
+                float_X sinPhiRot;
+                float_X cosPhiRot;
+
+                /** Calculate the constants of a TWTS laser pulse
+                 *
+                 * The parameters are the same as for the TWTS EField and BField.
+                 */
+                HINLINE PulseConstants(
+                    float_64 const wavelength_SI,
+                    float_64 const pulselength_SI,
+                    float_64 const w_x_SI,
+                    float_X const phi,
+                    float_X const beta_0)
+                {
+                    auto const beta0 = float_T(beta_0);
+                    /* If phi < 0 the formulas of the field functions are not directly applicable.
+                     * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
+                     * z-axis of the coordinate system in the field functions.
+                     */
+                    auto const phiReal = float_T(math::abs(phi));
+                    float_T sinPhiReal;
+                    float_T cosPhiReal;
+                    pmacc::math::sincos(phiReal, sinPhiReal, cosPhiReal);
+                    float_T const alphaTilt = math::atan2(float_T(1.0) - beta0 * cosPhiReal, beta0 * sinPhiReal);
+                    phiT = float_T(2.0) * alphaTilt;
+
+                    pmacc::math::sincos(phiT, sinPhi, cosPhi);
+                    cscPhi = float_T(1.0) / sinPhi;
+                    sinPhi2 = math::sin(phiT / float_T(2.0));
+                    cosPhi2 = math::cos(phiT / float_T(2.0));
+                    secPhi2 = float_T(1.0) / cosPhi2;
+                    tanPhi2 = math::tan(phiT / float_T(2.0));
+                    sin2Phi = math::sin(phiT * float_T(2.0));
+                    tanPI2_phi = math::tan(float_T(PI / 2.0) - phiT);
+
+                    cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
+                    auto const lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
+                    om0 = float_T(2.0 * PI) * cspeed / lambda0;
+                    tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
+                    auto const w0 = float_T(w_x_SI / UNIT_LENGTH);
+                    rho0 = float_T(PI * w0 * w0 / lambda0);
+                    k = float_T(2.0 * PI / lambda0);
+
+                    /* All quantities of the wavelength-periodicity have to be calculated in double precision. */
+                    float_64 sinPhiVal;
+                    float_64 cosPhiVal;
+                    pmacc::math::sincos(precisionCast<float_64>(phi), sinPhiVal, cosPhiVal);
+                    float_64 const tanAlpha = (1.0 - beta_0 * cosPhiVal) / (beta_0 * sinPhiVal);
+                    float_64 const tanFocalLine = math::tan(PI / 2.0 - phi);
+                    deltaT = wavelength_SI / SI::SPEED_OF_LIGHT_SI * (1.0 + tanAlpha / tanFocalLine);
+                    deltaY = wavelength_SI / tanFocalLine;
+                    deltaZ = -wavelength_SI;
+
+                    pmacc::math::sincos(phi, sinPhiRot, cosPhiRot);
+                }
+            };
+        } /* namespace detail */
+    } /* namespace templates */
+} /* namespace picongpu */
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "picongpu/fields/background/templates/PulseConstants.hpp"
 #include "picongpu/fields/background/templates/TWTS/numComponents.hpp"
 
 #include <pmacc/dimensions/DataSpace.hpp>
@@ -96,6 +97,8 @@ namespace picongpu
                 PMACC_ALIGN(auto_tdelay, const bool);
                 /* Polarization of TWTS laser */
                 PMACC_ALIGN(pol, const PolarizationType);
+                /** Position and time independent quantities of the TWTS laser pulse */
+                PMACC_ALIGN(pulse, const templates::detail::PulseConstants);
 
                 /** Magnetic field of the TWTS laser
                  *
@@ -67,6 +67,7 @@ namespace picongpu
                 , unit_length(UNIT_LENGTH)
                 , auto_tdelay(auto_tdelay)
                 , pol(pol)
+                , pulse(wavelength_SI, pulselength_SI, w_x_SI, phi, beta_0)
                 , phiPositive(float_X(1.0))
             {
                 /* Note: Enviroment-objects cannot be instantiated on CUDA GPU device. Since this is done
@@ -116,8 +117,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI/2+phi)].(By,Bz) for rotating back the field vectors.
                  */
-                const float_64 By_rot = -math::sin(+phi) * By_By + math::cos(+phi) * Bz_By;
-                const float_64 Bz_rot = -math::cos(+phi) * By_Bz - math::sin(+phi) * Bz_Bz;
+                const float_64 By_rot = -pulse.sinPhiRot * By_By + pulse.cosPhiRot * Bz_By;
+                const float_64 Bz_rot = -pulse.cosPhiRot * By_Bz - pulse.sinPhiRot * Bz_Bz;
 
                 /* Finally, the B-field normalized to the peak amplitude. */
                 return float3_X(float_X(0.0), float_X(By_rot), float_X(Bz_rot));
@@ -146,8 +147,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI/2+phi)].(By,Bz) for rotating back the field-vectors.
                  */
-                const float_64 By_rot = +math::cos(+phi) * Bz_By;
-                const float_64 Bz_rot = -math::sin(+phi) * Bz_Bz;
+                const float_64 By_rot = +pulse.cosPhiRot * Bz_By;
+                const float_64 Bz_rot = -pulse.sinPhiRot * Bz_Bz;
 
                 /* Finally, the B-field normalized to the peak amplitude. */
                 return float3_X(float_X(calcTWTSBx(pos[0], time)), float_X(By_rot), float_X(Bz_rot));
@@ -205,8 +206,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI / 2+phi)].(By,Bx) for rotating back the field vectors.
                  */
-                const float_64 By_rot = -math::sin(phi) * By_By + math::cos(phi) * Bx_By;
-                const float_64 Bx_rot = -math::cos(phi) * By_Bx - math::sin(phi) * Bx_Bx;
+                const float_64 By_rot = -pulse.sinPhiRot * By_By + pulse.cosPhiRot * Bx_By;
+                const float_64 Bx_rot = -pulse.cosPhiRot * By_Bx - pulse.sinPhiRot * Bx_Bx;
 
                 /* Finally, the B-field normalized to the peak amplitude. */
                 return float3_X(float_X(Bx_rot), float_X(By_rot), float_X(0.0));
@@ -260,8 +261,8 @@ namespace picongpu
                  * RotationMatrix[-(PI / 2+phi)].(By,Bx)
                  * for rotating back the field-vectors.
                  */
-                const float_64 By_rot = +math::cos(phi) * Bx_By;
-                const float_64 Bx_rot = -math::sin(phi) * Bx_Bx;
+                const float_64 By_rot = +pulse.cosPhiRot * Bx_By;
+                const float_64 Bx_rot = -pulse.sinPhiRot * Bx_Bx;
 
                 /* Finally, the B-field normalized to the peak amplitude. */
                 return float3_X(float_X(Bx_rot), float_X(By_rot), float_X(calcTWTSBx(pos[2], time)));
@@ -302,43 +303,15 @@ namespace picongpu
                 /* Unit of length */
                 const float_64 UNIT_LENGTH = UNIT_TIME * UNIT_SPEED;
 
-                /* Propagation speed of overlap normalized to the speed of light [Default: beta0=1.0] */
-                const auto beta0 = float_T(beta_0);
-                /* If phi < 0 the formulas below are not directly applicable.
-                 * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
-                 * z-axis of the coordinate system in this function.
+                /* Position and time independent quantities are calculated once on the host,
+                 * see templates::detail::PulseConstants.
                  */
-                const auto phiReal = float_T(math::abs(phi));
-                const float_T alphaTilt
-                    = math::atan2(float_T(1.0) - beta0 * math::cos(phiReal), beta0 * math::sin(phiReal));
-                /* Definition of the laser pulse front tilt angle for the laser field below.
-                 *
-                 * For beta0=1.0, this is equivalent to our standard definition. Question: Why is the
-                 * local "phi_T" not equal in value to the object member "phiReal" or "phi"?
-                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
-                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
-                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
-                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
-                 * scenarios close to beta0 = 1.
-                 */
-                const float_T phiT = float_T(2.0) * alphaTilt;
-
-                /* Angle between the laser pulse front and the y-axis. Not used, but remains in code for
-                 * documentation purposes.
-                 * const float_T eta = float_T(PI/2) - (phiReal - alphaTilt);
-                 */
-
-                const auto cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
-                const auto lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
-                const auto om0 = float_T(2.0 * PI * cspeed / lambda0);
-                /* factor 2  in tauG arises from definition convention in laser formula */
-                const auto tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
-                /* w0 is wx here --> w0 could be replaced by wx */
-                const auto w0 = float_T(w_x_SI / UNIT_LENGTH);
-                const auto rho0 = float_T(PI * w0 * w0 / lambda0);
-                /* wy is width of TWTS pulse */
+                const float_T cspeed = pulse.cspeed;
+                const float_T om0 = pulse.om0;
+                const float_T tauG = pulse.tauG;
+                const float_T rho0 = pulse.rho0;
                 const auto wy = float_T(w_y_SI / UNIT_LENGTH);
-                const auto k = float_T(2.0 * PI / lambda0);
+                const float_T k = pulse.k;
                 /* If phi < 0 the entire pulse is rotated by 180 deg around the
                  * z-axis of the coordinate system without also changing
                  * the orientation of the resulting field vectors.
@@ -349,17 +322,18 @@ namespace picongpu
                 const auto t = float_T(time / UNIT_TIME);
 
                 /* Shortcuts for speeding up the field calculation. */
-                const float_T sinPhi = math::sin(phiT);
-                const float_T cosPhi = math::cos(phiT);
-                const float_T cosPhi2 = math::cos(phiT / 2.0);
-                const float_T tanPhi2 = math::tan(phiT / 2.0);
+                const float_T sinPhi = pulse.sinPhi;
+                const float_T cosPhi = pulse.cosPhi;
+                const float_T cosPhi2 = pulse.cosPhi2;
+                const float_T tanPhi2 = pulse.tanPhi2;
+                const float_T tanPI2_phi = pulse.tanPI2_phi;
 
                 /* The "helpVar" variables decrease the nesting level of the evaluated expressions and
                  * thus help with formal code verification through manual code inspection.
                  */
                 const complex_T helpVar1 = rho0 + complex_T(0, 1) * y * cosPhi + complex_T(0, 1) * z * sinPhi;
                 const complex_T helpVar2 = cspeed * om0 * tauG * tauG
-                    + complex_T(0, 2) * (-z - y * math::tan(float_T(PI / 2) - phiT)) * tanPhi2 * tanPhi2;
+                    + complex_T(0, 2) * (-z - y * tanPI2_phi) * tanPhi2 * tanPhi2;
                 const complex_T helpVar3 = complex_T(0, 1) * rho0 - y * cosPhi - z * sinPhi;
 
                 const complex_T helpVar4 = float_T(-1.0)
@@ -377,14 +351,10 @@ namespace picongpu
                        - float_T(4.0) * cspeed * om0 * t * wy * wy * z * rho0 * tanPhi2 * tanPhi2
                        - complex_T(0, 4) * cspeed * y * y * z * rho0 * tanPhi2 * tanPhi2
                        + float_T(4.0) * om0 * wy * wy * z * z * rho0 * tanPhi2 * tanPhi2
-                       - complex_T(0, 2) * cspeed * k * wy * wy * x * x * y * math::tan(float_T(PI / 2) - phiT)
-                           * tanPhi2 * tanPhi2
-                       - float_T(4.0) * cspeed * om0 * t * wy * wy * y * rho0 * math::tan(float_T(PI / 2) - phiT)
-                           * tanPhi2 * tanPhi2
-                       - complex_T(0, 4) * cspeed * y * y * y * rho0 * math::tan(float_T(PI / 2) - phiT) * tanPhi2
-                           * tanPhi2
-                       + float_T(4.0) * om0 * wy * wy * y * z * rho0 * math::tan(float_T(PI / 2) - phiT) * tanPhi2
-                           * tanPhi2
+                       - complex_T(0, 2) * cspeed * k * wy * wy * x * x * y * tanPI2_phi * tanPhi2 * tanPhi2
+                       - float_T(4.0) * cspeed * om0 * t * wy * wy * y * rho0 * tanPI2_phi * tanPhi2 * tanPhi2
+                       - complex_T(0, 4) * cspeed * y * y * y * rho0 * tanPI2_phi * tanPhi2 * tanPhi2
+                       + float_T(4.0) * om0 * wy * wy * y * z * rho0 * tanPI2_phi * tanPhi2 * tanPhi2
                        + float_T(2.0) * z * sinPhi
                            * (+om0
                                   * (+cspeed * cspeed
@@ -410,7 +380,7 @@ namespace picongpu
                                      - float_T(2.0) * y
                                          * (+cspeed * om0 * t * wy * wy + complex_T(0, 1) * cspeed * y * y
                                             - om0 * wy * wy * z)
-                                         * math::tan(float_T(PI / 2) - phiT))
+                                         * tanPI2_phi)
                                   * tanPhi2 * tanPhi2)
                        /* The "round-trip" conversion in the line below fixes a gross accuracy bug
                         * in floating-point arithmetics, when float_T is set to float_X.
@@ -419,11 +389,11 @@ namespace picongpu
                     * complex_T(float_64(1.0) / complex_64(float_T(2.0) * cspeed * wy * wy * helpVar1 * helpVar2));
 
                 const complex_T helpVar5 = complex_T(0, -1) * cspeed * om0 * tauG * tauG
-                    + (-z - y * math::tan(float_T(PI / 2) - phiT)) * tanPhi2 * tanPhi2 * float_T(2.0);
+                    + (-z - y * tanPI2_phi) * tanPhi2 * tanPhi2 * float_T(2.0);
                 const complex_T helpVar6
                     = (cspeed
                        * (cspeed * om0 * tauG * tauG
-                          + complex_T(0, 2) * (-z - y * math::tan(float_T(PI / 2) - phiT)) * tanPhi2 * tanPhi2))
+                          + complex_T(0, 2) * (-z - y * tanPI2_phi) * tanPhi2 * tanPhi2))
                     / (om0 * rho0);
                 const complex_T result
                     = (math::exp(helpVar4) * tauG / cosPhi2 / cosPhi2
@@ -452,44 +422,15 @@ namespace picongpu
                 /** Unit of length */
                 const float_64 UNIT_LENGTH = UNIT_TIME * UNIT_SPEED;
 
-                /* propagation speed of overlap normalized to the speed of light [Default: beta0=1.0] */
-                const auto beta0 = float_T(beta_0);
-                /* If phi < 0 the formulas below are not directly applicable.
-                 * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
-                 * z-axis of the coordinate system in this function.
-                 */
-                const auto phiReal = float_T(math::abs(phi));
-                const float_T alphaTilt
-                    = math::atan2(float_T(1.0) - beta0 * math::cos(phiReal), beta0 * math::sin(phiReal));
-
-                /* Definition of the laser pulse front tilt angle for the laser field below.
-                 *
-                 * For beta0=1.0, this is equivalent to our standard definition. Question: Why is the
-                 * local "phi_T" not equal in value to the object member "phiReal" or "phi"?
-                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
-                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
-                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
-                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
-                 * scenarios close to beta0 = 1.
-                 */
-                const float_T phiT = float_T(2.0) * alphaTilt;
-
-                /* Angle between the laser pulse front and the y-axis.
-                 * Not used, but remains in code for documentation purposes.
-                 * const float_T eta = float_T(float_T(PI / 2)) - (phiReal - alphaTilt);
+                /* Position and time independent quantities are calculated once on the host,
+                 * see templates::detail::PulseConstants.
                  */
-
-                const auto cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
-                const auto lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
-                const auto om0 = float_T(2.0 * PI * cspeed / lambda0);
-                /* factor 2  in tauG arises from definition convention in laser formula */
-                const auto tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
-                /* w0 is wx here --> w0 could be replaced by wx */
-                const auto w0 = float_T(w_x_SI / UNIT_LENGTH);
-                const auto rho0 = float_T(PI * w0 * w0 / lambda0);
-                /* wy is width of TWTS pulse */
+                const float_T cspeed = pulse.cspeed;
+                const float_T om0 = pulse.om0;
+                const float_T tauG = pulse.tauG;
+                const float_T rho0 = pulse.rho0;
                 const auto wy = float_T(w_y_SI / UNIT_LENGTH);
-                const auto k = float_T(2.0 * PI / lambda0);
+                const float_T k = pulse.k;
                 /* If phi < 0 the entire pulse is rotated by 180 deg around the
                  * z-axis of the coordinate system without also changing
                  * the orientation of the resulting field vectors.
@@ -500,16 +441,17 @@ namespace picongpu
                 const auto t = float_T(time / UNIT_TIME);
 
                 /* Shortcuts for speeding up the field calculation. */
-                const float_T sinPhi = math::sin(phiT);
-                const float_T cosPhi = math::cos(phiT);
-                const float_T sinPhi2 = math::sin(phiT / float_T(2.0));
-                const float_T cosPhi2 = math::cos(phiT / float_T(2.0));
-                const float_T tanPhi2 = math::tan(phiT / float_T(2.0));
+                const float_T sinPhi = pulse.sinPhi;
+                const float_T cosPhi = pulse.cosPhi;
+                const float_T sinPhi2 = pulse.sinPhi2;
+                const float_T cosPhi2 = pulse.cosPhi2;
+                const float_T tanPhi2 = pulse.tanPhi2;
+                const float_T tanPI2_phi = pulse.tanPI2_phi;
 
                 /* The "helpVar" variables decrease the nesting level of the evaluated expressions and
                  * thus help with formal code verification through manual code inspection.
                  */
-                const complex_T helpVar1 = -(cspeed * z) - cspeed * y * math::tan(float_T(PI / 2) - phiT)
+                const complex_T helpVar1 = -(cspeed * z) - cspeed * y * tanPI2_phi
                     + complex_T(0, 1) * cspeed * rho0 / sinPhi;
                 const complex_T helpVar2 = complex_T(0, 1) * rho0 - y * cosPhi - z * sinPhi;
                 const complex_T helpVar3 = helpVar2 * cspeed;
@@ -579,43 +521,15 @@ namespace picongpu
                 /** Unit of length */
                 const float_64 UNIT_LENGTH = UNIT_TIME * UNIT_SPEED;
 
-                /* Propagation speed of overlap normalized to the speed of light [Default: beta0=1.0] */
-                const auto beta0 = float_T(beta_0);
-                /* If phi < 0 the formulas below are not directly applicable.
-                 * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
-                 * z-axis of the coordinate system in this function.
-                 */
-                const auto phiReal = float_T(math::abs(phi));
-                const float_T alphaTilt
-                    = math::atan2(float_T(1.0) - beta0 * math::cos(phiReal), beta0 * math::sin(phiReal));
-                /* Definition of the laser pulse front tilt angle for the laser field below.
-                 *
-                 * For beta0=1.0, this is equivalent to our standard definition. Question: Why is the
-                 * local "phi_T" not equal in value to the object member "phiReal" or "phi"?
-                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
-                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
-                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
-                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
-                 * scenarios close to beta0 = 1.
-                 */
-                const float_T phiT = float_T(2.0) * alphaTilt;
-
-                /* Angle between the laser pulse front and the y-axis.
-                 * Not used, but remains in code for documentation purposes.
-                 * const float_T eta = float_T(float_T(PI / 2)) - (phiReal - alphaTilt);
+                /* Position and time independent quantities are calculated once on the host,
+                 * see templates::detail::PulseConstants.
                  */
-
-                const auto cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
-                const auto lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
-                const auto om0 = float_T(2.0 * PI * cspeed / lambda0);
-                /* factor 2  in tauG arises from definition convention in laser formula */
-                const auto tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
-                /* w0 is wx here --> w0 could be replaced by wx */
-                const auto w0 = float_T(w_x_SI / UNIT_LENGTH);
-                const auto rho0 = float_T(PI * w0 * w0 / lambda0);
-                /* wy is width of TWTS pulse */
+                const float_T cspeed = pulse.cspeed;
+                const float_T om0 = pulse.om0;
+                const float_T tauG = pulse.tauG;
+                const float_T rho0 = pulse.rho0;
                 const auto wy = float_T(w_y_SI / UNIT_LENGTH);
-                const auto k = float_T(2.0 * PI / lambda0);
+                const float_T k = pulse.k;
                 /* If phi < 0 the entire pulse is rotated by 180 deg around the
                  * z-axis of the coordinate system without also changing
                  * the orientation of the resulting field vectors.
@@ -626,11 +540,12 @@ namespace picongpu
                 const auto t = float_T(time / UNIT_TIME);
 
                 /* Shortcuts for speeding up the field calculation. */
-                const float_T sinPhi = math::sin(phiT);
-                const float_T cosPhi = math::cos(phiT);
-                const float_T sinPhi2 = math::sin(phiT / float_T(2.0));
-                const float_T cosPhi2 = math::cos(phiT / float_T(2.0));
-                const float_T tanPhi2 = math::tan(phiT / float_T(2.0));
+                const float_T sinPhi = pulse.sinPhi;
+                const float_T cosPhi = pulse.cosPhi;
+                const float_T sinPhi2 = pulse.sinPhi2;
+                const float_T cosPhi2 = pulse.cosPhi2;
+                const float_T tanPhi2 = pulse.tanPhi2;
+                const float_T tanPI2_phi = pulse.tanPI2_phi;
 
                 /* The "helpVar" variables decrease the nesting level of the evaluated expressions and
                  * thus help with formal code verification through manual code inspection.
@@ -655,7 +570,7 @@ namespace picongpu
                                   * (cspeed * k * wy * wy * x * x - complex_T(0, 2) * cspeed * om0 * t * wy * wy * rho0
                                      + float_T(2.0) * cspeed * y * y * rho0
                                      + complex_T(0, 2) * om0 * wy * wy * z * rho0)
-                                  * math::tan(float_T(PI) / float_T(2.0) - phiT) / sinPhi)
+                                  * tanPI2_phi / sinPhi)
                            * sinPhi2 * sinPhi2 * sinPhi2 * sinPhi2
                        - complex_T(0, 2) * cspeed * cspeed * om0 * t * t * wy * wy * z * sinPhi
                        - float_T(2.0) * cspeed * cspeed * om0 * om0 * t * tauG * tauG * wy * wy * z * sinPhi
@@ -694,7 +609,7 @@ namespace picongpu
 
                 const complex_T helpVar4 = (cspeed * om0
                                             * (cspeed * om0 * tauG * tauG
-                                               - complex_T(0, 8) * y * math::tan(float_T(PI) / float_T(2.0) - phiT)
+                                               - complex_T(0, 8) * y * tanPI2_phi
                                                    / sinPhi / sinPhi * sinPhi2 * sinPhi2 * sinPhi2 * sinPhi2
                                                - complex_T(0, 2) * z * tanPhi2 * tanPhi2))
                     / rho0;
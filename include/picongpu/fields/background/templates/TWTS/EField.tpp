@@ -66,6 +66,7 @@ namespace picongpu
                 , unit_length(UNIT_LENGTH)
                 , auto_tdelay(auto_tdelay)
                 , pol(pol)
+                , pulse(wavelength_SI, pulselength_SI, w_x_SI, phi, beta_0)
                 , phiPositive(float_X(1.0))
             {
                 /* Note: Enviroment-objects cannot be instantiated on CUDA GPU device. Since this is done
@@ -120,8 +121,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI/2+phi)].(Ey,Ez) for rotating back the field-vectors.
                  */
-                const float_64 Ey_rot = -math::sin(+phi) * Ey_Ey;
-                const float_64 Ez_rot = -math::cos(+phi) * Ey_Ez;
+                const float_64 Ey_rot = -pulse.sinPhiRot * Ey_Ey;
+                const float_64 Ez_rot = -pulse.cosPhiRot * Ey_Ez;
 
                 /* Finally, the E-field normalized to the peak amplitude. */
                 return float3_X(float_X(0.0), float_X(Ey_rot), float_X(Ez_rot));
@@ -170,8 +171,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI / 2+phi)].(Ey,Ex) for rotating back the field-vectors.
                  */
-                const float_64 Ey_rot = -math::sin(+phi) * Ey_Ey;
-                const float_64 Ex_rot = -math::cos(+phi) * Ey_Ex;
+                const float_64 Ey_rot = -pulse.sinPhiRot * Ey_Ey;
+                const float_64 Ex_rot = -pulse.cosPhiRot * Ey_Ex;
 
                 /* Finally, the E-field normalized to the peak amplitude. */
                 return float3_X(float_X(Ex_rot), float_X(Ey_rot), float_X(0.0));
@@ -213,54 +214,27 @@ namespace picongpu
                 /* Unit of length */
                 const float_64 UNIT_LENGTH = UNIT_TIME * UNIT_SPEED;
 
-                /* Propagation speed of overlap normalized to the speed of light [Default: beta0=1.0] */
-                const auto beta0 = float_T(beta_0);
-                /* If phi < 0 the formulas below are not directly applicable.
-                 * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
-                 * z-axis of the coordinate system in this function.
+                /* Position and time independent quantities are calculated once on the host,
+                 * see templates::detail::PulseConstants.
                  */
-                const auto phiReal = float_T(math::abs(phi));
-                const float_T alphaTilt
-                    = math::atan2(float_T(1.0) - beta0 * math::cos(phiReal), beta0 * math::sin(phiReal));
-                /* Definition of the laser pulse front tilt angle for the laser field below.
-                 *
-                 * For beta0 = 1.0, this is equivalent to our standard definition. Question: Why is the
-                 * local "phi_T" not equal in value to the object member "phiReal" or "phi"?
-                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
-                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
-                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
-                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
-                 * scenarios close to beta0 = 1.
-                 */
-                const float_T phiT = float_T(2.0) * alphaTilt;
-
-                /* Angle between the laser pulse front and the y-axis. Not used, but remains in code for
-                 * documentation purposes.
-                 * const float_T eta = (PI / 2) - (phiReal - alphaTilt);
-                 */
-
-                const auto cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
-                const auto lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
-                const auto om0 = float_T(2.0 * PI * cspeed / lambda0);
-                /* factor 2  in tauG arises from definition convention in laser formula */
-                const auto tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
-                /* w0 is wx here --> w0 could be replaced by wx */
-                const auto w0 = float_T(w_x_SI / UNIT_LENGTH);
-                const auto rho0 = float_T(PI * w0 * w0 / lambda0);
-                /* wy is width of TWTS pulse */
+                const float_T cspeed = pulse.cspeed;
+                const float_T om0 = pulse.om0;
+                const float_T tauG = pulse.tauG;
+                const float_T rho0 = pulse.rho0;
                 const auto wy = float_T(w_y_SI / UNIT_LENGTH);
-                const auto k = float_T(2.0 * PI / lambda0);
+                const float_T k = pulse.k;
                 const auto x = float_T(phiPositive * pos.x() / UNIT_LENGTH);
                 const auto y = float_T(phiPositive * pos.y() / UNIT_LENGTH);
                 const auto z = float_T(pos.z() / UNIT_LENGTH);
                 const auto t = float_T(time / UNIT_TIME);
 
                 /* Calculating shortcuts for speeding up field calculation */
-                const float_T sinPhi = math::sin(phiT);
-                const float_T cosPhi = math::cos(phiT);
-                const float_T sinPhi2 = math::sin(phiT / float_T(2.0));
-                const float_T cosPhi2 = math::cos(phiT / float_T(2.0));
-                const float_T tanPhi2 = math::tan(phiT / float_T(2.0));
+                const float_T sinPhi = pulse.sinPhi;
+                const float_T cosPhi = pulse.cosPhi;
+                const float_T sinPhi2 = pulse.sinPhi2;
+                const float_T cosPhi2 = pulse.cosPhi2;
+                const float_T tanPhi2 = pulse.tanPhi2;
+                const float_T tanPI2_phi = pulse.tanPI2_phi;
 
                 /* The "helpVar" variables decrease the nesting level of the evaluated expressions and
                  * thus help with formal code verification through manual code inspection.
@@ -287,7 +261,7 @@ namespace picongpu
                                      - complex_T(0, 2) * cspeed * om0 * t * wy * wy * rho0
                                      + float_T(2.0) * cspeed * y * y * rho0
                                      + complex_T(0, 2) * om0 * wy * wy * z * rho0)
-                                  * math::tan(float_T(PI / 2.0) - phiT) / sinPhi)
+                                  * tanPI2_phi / sinPhi)
                            * sinPhi2 * sinPhi2 * sinPhi2 * sinPhi2
                        - complex_T(0, 2) * cspeed * cspeed * om0 * t * t * wy * wy * z * sinPhi
                        - float_T(2.0) * cspeed * cspeed * om0 * om0 * t * tauG * tauG * wy * wy * z * sinPhi
@@ -324,8 +298,7 @@ namespace picongpu
                     * complex_T(float_64(1.0) / complex_64(float_T(2.0) * cspeed * wy * wy * helpVar1 * helpVar2));
 
                 const complex_T helpVar5 = cspeed * om0 * tauG * tauG
-                    - complex_T(0, 8) * y * math::tan(float_T(PI / 2) - phiT) / sinPhi / sinPhi * sinPhi2 * sinPhi2
-                        * sinPhi2 * sinPhi2
+                    - complex_T(0, 8) * y * tanPI2_phi / sinPhi / sinPhi * sinPhi2 * sinPhi2 * sinPhi2 * sinPhi2
                     - complex_T(0, 2) * z * tanPhi2 * tanPhi2;
                 const complex_T result = (math::exp(helpVar4) * tauG * math::sqrt((cspeed * om0 * rho0) / helpVar3))
                     / math::sqrt(helpVar5);
@@ -20,6 +20,7 @@
 
 #pragma once
 
+#include "picongpu/fields/background/templates/PulseConstants.hpp"
 #include "picongpu/fields/background/templates/twtsfast/numComponents.hpp"
 
 #include <pmacc/dimensions/DataSpace.hpp>
@@ -94,6 +95,8 @@ namespace picongpu
                 PMACC_ALIGN(auto_tdelay, bool const);
                 /** Polarization of TWTS laser */
                 PMACC_ALIGN(pol, PolarizationType const);
+                /** Position and time independent quantities of the TWTS laser pulse */
+                PMACC_ALIGN(pulse, templates::detail::PulseConstants const);
 
                 /** Magnetic field of the TWTS laser
                  *
@@ -64,6 +64,7 @@ namespace picongpu
                 , unit_length(UNIT_LENGTH)
                 , auto_tdelay(auto_tdelay)
                 , pol(pol)
+                , pulse(wavelength_SI, pulselength_SI, w_x_SI, phi, beta_0)
                 , phiPositive(float_X(1.0))
             {
                 /* Note: Enviroment-objects cannot be instantiated on CUDA GPU device. Since this is done
@@ -118,9 +119,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI/2+phi)].(Ey,Ez) for rotating back the field-vectors.
                  */
-                float_X sinPhi;
-                float_X cosPhi;
-                pmacc::math::sincos(phi, sinPhi, cosPhi);
+                float_X const sinPhi = pulse.sinPhiRot;
+                float_X const cosPhi = pulse.cosPhiRot;
                 float_X const Ey_rot = -sinPhi * float_X(Ey_Ey);
                 float_X const Ez_rot = -cosPhi * float_X(Ey_Ez);
 
@@ -171,9 +171,8 @@ namespace picongpu
                  *
                  * RotationMatrix[-(PI / 2+phi)].(Ey,Ex) for rotating back the field-vectors.
                  */
-                float_X sinPhi;
-                float_X cosPhi;
-                pmacc::math::sincos(phi, sinPhi, cosPhi);
+                float_X const sinPhi = pulse.sinPhiRot;
+                float_X const cosPhi = pulse.cosPhiRot;
                 float_X const Ey_rot = -sinPhi * float_X(Ey_Ey);
                 float_X const Ex_rot = -cosPhi * float_X(Ey_Ex);
 
@@ -211,43 +210,14 @@ namespace picongpu
                 using complex_T = pmacc::math::Complex<float_T>;
                 using complex_64 = pmacc::math::Complex<float_64>;
 
-                /* Propagation speed of overlap normalized to the speed of light [Default: beta0=1.0] */
-                auto const beta0 = float_T(beta_0);
-                /* If phi < 0 the formulas below are not directly applicable.
-                 * Instead phi is taken positive, but the entire pulse rotated by 180 deg around the
-                 * z-axis of the coordinate system in this function.
+                /* Position and time independent quantities are calculated once on the host,
+                 * see templates::detail::PulseConstants.
                  */
-                auto const phiReal = float_T(math::abs(phi));
-                float_T sinPhiReal;
-                float_T cosPhiReal;
-                pmacc::math::sincos(phiReal, sinPhiReal, cosPhiReal);
-                float_T const alphaTilt = math::atan2(float_T(1.0) - beta0 * cosPhiReal, beta0 * sinPhiReal);
-                /* Definition of the laser pulse front tilt angle for the laser field below.
-                 *
-                 * For beta0 = 1.0, this is equivalent to our standard definition. Question: Why is the
-                 * local "phi_T" not equal in value to the object member "phiReal" or "phi"?
-                 * Because the standard TWTS pulse is defined for beta0 = 1.0 and in the coordinate-system
-                 * of the TWTS model phi is responsible for pulse front tilt and dispersion only. Hence
-                 * the dispersion will (although physically correct) be slightly off the ideal TWTS
-                 * pulse for beta0 != 1.0. This only shows that this TWTS pulse is primarily designed for
-                 * scenarios close to beta0 = 1.
-                 */
-                float_T const phiT = float_T(2.0) * alphaTilt;
-
-                /* Angle between the laser pulse front and the y-axis. Not used, but remains in code for
-                 * documentation purposes.
-                 * float_T const eta = (PI / 2) - (phiReal - alphaTilt);
-                 */
-
-                auto const cspeed = float_T(SI::SPEED_OF_LIGHT_SI / UNIT_SPEED);
-                auto const lambda0 = float_T(wavelength_SI / UNIT_LENGTH);
-                float_T const om0 = float_T(2.0 * PI) * cspeed / lambda0;
-                /* factor 2  in tauG arises from definition convention in laser formula */
-                auto const tauG = float_T(pulselength_SI * 2.0 / UNIT_TIME);
-                /* w0 is wx here --> w0 could be replaced by wx */
-                auto const w0 = float_T(w_x_SI / UNIT_LENGTH);
-                auto const rho0 = float_T(PI * w0 * w0 / lambda0);
-                auto const k = float_T(2.0 * PI / lambda0);
+                float_T const cspeed = pulse.cspeed;
+                float_T const om0 = pulse.om0;
+                float_T const tauG = pulse.tauG;
+                float_T const rho0 = pulse.rho0;
+                float_T const k = pulse.k;
 
                 /* In order to calculate in single-precision and in order to account for errors in
                  * the approximations far from the coordinate origin, we use the wavelength-periodicity and
@@ -255,18 +225,10 @@ namespace picongpu
                  * (i.e. from a finite coordinate range) only. All these quantities have to be calculated
                  * in double precision.
                  */
-                float_64 sinPhiVal;
-                float_64 cosPhiVal;
-                pmacc::math::sincos(precisionCast<float_64>(phi), sinPhiVal, cosPhiVal);
-                float_64 const tanAlpha = (1.0 - beta_0 * cosPhiVal) / (beta_0 * sinPhiVal);
-                float_64 const tanFocalLine = math::tan(PI / 2.0 - phi);
-                float_64 const deltaT = wavelength_SI / SI::SPEED_OF_LIGHT_SI * (1.0 + tanAlpha / tanFocalLine);
-                float_64 const deltaY = wavelength_SI / tanFocalLine;
-                float_64 const deltaZ = -wavelength_SI;
-                float_64 const numberOfPeriods = math::floor(time / deltaT);
-                auto const timeMod = float_T(time - numberOfPeriods * deltaT);
-                auto const yMod = float_T(pos.y() + numberOfPeriods * deltaY);
-                auto const zMod = float_T(pos.z() + numberOfPeriods * deltaZ);
+                float_64 const numberOfPeriods = math::floor(time / pulse.deltaT);
+                auto const timeMod = float_T(time - numberOfPeriods * pulse.deltaT);
+                auto const yMod = float_T(pos.y() + numberOfPeriods * pulse.deltaY);
+                auto const zMod = float_T(pos.z() + numberOfPeriods * pulse.deltaZ);
 
                 auto const x = float_T(phiPositive * pos.x() / UNIT_LENGTH);
                 auto const y = float_T(phiPositive * yMod / UNIT_LENGTH);
@@ -274,13 +236,12 @@ namespace picongpu
                 auto const t = float_T(timeMod / UNIT_TIME);
 
                 /* Calculating shortcuts for speeding up field calculation */
-                float_T sinPhi;
-                float_T cosPhi;
-                pmacc::math::sincos(phiT, sinPhi, cosPhi);
-                float_T const cscPhi = float_T(1.0) / sinPhi;
-                float_T const sinPhi2 = math::sin(phiT / float_T(2.0));
-                float_T const sin2Phi = math::sin(phiT * float_T(2.0));
-                float_T const tanPhi2 = math::tan(phiT / float_T(2.0));
+                float_T const sinPhi = pulse.sinPhi;
+                float_T const cosPhi = pulse.cosPhi;
+                float_T const cscPhi = pulse.cscPhi;
+                float_T const sinPhi2 = pulse.sinPhi2;
+                float_T const sin2Phi = pulse.sin2Phi;
+                float_T const tanPhi2 = pulse.tanPhi2;
 
                 float_T const sinPhi_2 = sinPhi * sinPhi;
                 float_T const sinPhi_3 = sinPhi * sinPhi_2;
@@ -331,7 +292,7 @@ namespace picongpu
                     / (cspeed * helpVar2 * helpVar1);
 
                 complex_T const helpVar4 = cspeed * om0 * tauG2
-                    - complex_T(0, 8) * y * math::tan(float_T(PI / 2.0) - phiT) * cscPhi * cscPhi * sinPhi2_4
+                    - complex_T(0, 8) * y * pulse.tanPI2_phi * cscPhi * cscPhi * sinPhi2_4
                     - complex_T(0, 2) * z * tanPhi2_2;
 
                 complex_T const result
@@ -47,17 +47,26 @@ namespace picongpu
                 /** Create a cache
                  *
                  * @attention thread-collective operation, requires external thread synchronization
+                 *
+                 * @tparam T_sharedMemId id of the shared memory used for the cache, must be unique within a kernel
                  */
-                template<uint32_t T_numWorkers, typename T_BlockDescription, typename T_Acc, typename T_FieldBox>
+                template<
+                    uint32_t T_numWorkers,
+                    typename T_BlockDescription,
+                    uint32_t T_sharedMemId = 0u,
+                    typename T_Acc,
+                    typename T_FieldBox>
                 DINLINE static auto create(T_Acc const& acc, T_FieldBox const& fieldBox, uint32_t const workerIdx)
 #if(!BOOST_COMP_CLANG)
                     -> decltype(
-                        CachedBox::create<0u, typename T_FieldBox::ValueType>(acc, std::declval<T_BlockDescription>()))
+                        CachedBox::create<T_sharedMemId, typename T_FieldBox::ValueType>(
+                            acc,
+                            std::declval<T_BlockDescription>()))
 #endif
                 {
                     using ValueType = typename T_FieldBox::ValueType;
                     /* this memory is used by all virtual blocks */
-                    auto cache = CachedBox::create<0u, ValueType>(acc, T_BlockDescription{});
+                    auto cache = CachedBox::create<T_sharedMemId, ValueType>(acc, T_BlockDescription{});
 
                     Set<ValueType> set(ValueType::create(0.0_X));
                     ThreadCollective<T_BlockDescription, T_numWorkers> collectiveFill(workerIdx);
@@ -97,8 +106,15 @@ namespace picongpu
                 /** Create a cache
                  *
                  * @attention thread-collective operation, requires external thread synchronization
+                 *
+                 * @tparam T_sharedMemId id of the shared memory used for the cache, must be unique within a kernel
                  */
-                template<uint32_t T_numWorkers, typename T_BlockDescription, typename T_Acc, typename T_FieldBox>
+                template<
+                    uint32_t T_numWorkers,
+                    typename T_BlockDescription,
+                    uint32_t T_sharedMemId = 0u,
+                    typename T_Acc,
+                    typename T_FieldBox>
                 DINLINE static auto create(T_Acc const& acc, T_FieldBox const& fieldBox, uint32_t const workerIdx)
 #if(!BOOST_COMP_CLANG)
                     -> T_FieldBox
@@ -451,6 +451,14 @@ namespace picongpu
                     updateBHalf<2, ZMin, ZMax>(sourceTimeIteration);
                 }
 
+                //! Whether there is an active (non-none) source at any boundary
+                static constexpr bool isEnabled()
+                {
+                    return !std::is_same<XMin, None>::value || !std::is_same<XMax, None>::value
+                        || !std::is_same<YMin, None>::value || !std::is_same<YMax, None>::value
+                        || !std::is_same<ZMin, None>::value || !std::is_same<ZMax, None>::value;
+                }
+
             private:
                 /** Apply contribution of the incident B field to the E field update by one time step
                  *
@@ -26,6 +26,7 @@
 
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/mappings/simulation/SubGrid.hpp>
+#include <pmacc/memory/Array.hpp>
 
 
 namespace picongpu
@@ -74,35 +75,6 @@ namespace picongpu
 
                     float_X m_phase;
 
-                    /** Simple iteration algorithm to implement Laguerre polynomials for GPUs.
-                     *
-                     *  @param n order of the Laguerre polynomial
-                     *  @param x coordinate at which the polynomial is evaluated
-                     *  @return ...
-                     */
-                    HDINLINE float_X simpleLaguerre(const uint32_t n, const float_X x)
-                    {
-                        // Result for special case n == 0
-                        if(n == 0)
-                            return 1.0_X;
-                        uint32_t currentN = 1;
-                        float_X laguerreNMinus1 = 1.0_X;
-                        float_X laguerreN = 1.0_X - x;
-                        float_X laguerreNPlus1(0.0_X);
-                        while(currentN < n)
-                        {
-                            // Core statement of the algorithm
-                            laguerreNPlus1 = ((2.0_X * float_X(currentN) + 1.0_X - x) * laguerreN
-                                              - float_X(currentN) * laguerreNMinus1)
-                                / float_X(currentN + 1u);
-                            // Advance by one order
-                            laguerreNMinus1 = laguerreN;
-                            laguerreN = laguerreNPlus1;
-                            currentN++;
-                        }
-                        return laguerreN;
-                    }
-
                     /** Device-Side Constructor
                      *
                      * @param superCellToLocalOriginCellOffset local offset in cells to current supercell
@@ -155,8 +127,6 @@ namespace picongpu
                         // inverse radius of curvature of the beam's  wavefronts
                         float_X const R_y_inv = -focusPos / (y_R * y_R + focusPos * focusPos);
 
-                        // initialize temporary variables
-                        float_X etrans(0.0_X);
                         float_X etrans_norm(0.0_X);
                         PMACC_CASSERT_MSG(
                             MODENUMBER_must_be_smaller_than_number_of_entries_in_LAGUERREMODES_vector,
@@ -169,65 +139,55 @@ namespace picongpu
                         //! the Gouy phase shift
                         float_X const xi_y = math::atan(-focusPos / y_R);
 
+                        /* transversal amplitude of each mode, does not depend on the laser phase
+                         *
+                         * The Laguerre polynomials of all orders are evaluated within a single run of the
+                         * three term recurrence.
+                         */
+                        float_X const laguerreArg = 2.0_X * r2 / w_y / w_y;
+                        float_X const gaussian = math::exp(-r2 / w_y / w_y);
+                        pmacc::memory::Array<float_X, Unitless::MODENUMBER + 1u> modeAmplitude;
+                        float_X laguerreNMinus1 = 0.0_X;
+                        float_X laguerreN = 1.0_X;
+                        for(uint32_t m = 0; m <= Unitless::MODENUMBER; ++m)
+                        {
+                            modeAmplitude[m] = typename Unitless::LAGUERREMODES_t{}[m] * laguerreN * gaussian;
+                            float_X const laguerreNPlus1
+                                = ((2.0_X * float_X(m) + 1.0_X - laguerreArg) * laguerreN
+                                   - float_X(m) * laguerreNMinus1)
+                                / float_X(m + 1u);
+                            laguerreNMinus1 = laguerreN;
+                            laguerreN = laguerreNPlus1;
+                        }
+
+                        // phase of the curved wave fronts, the same for all modes
+                        float_X const wavefrontPhase = 2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * focusPos
+                            - 2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * r2 / 2.0_X * R_y_inv;
+
+                        // sum of all modes for the given laser phase
+                        auto const sumModes = [&](float_X const phase) {
+                            float_X const longitudinalPos = r2 / 2.0_X * R_y_inv - focusPos
+                                - phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH;
+                            float_X const envelope = math::exp(
+                                -longitudinalPos * longitudinalPos / SPEED_OF_LIGHT / SPEED_OF_LIGHT
+                                / (2.0_X * Unitless::PULSE_LENGTH) / (2.0_X * Unitless::PULSE_LENGTH));
+                            float_X etrans(0.0_X);
+                            for(uint32_t m = 0; m <= Unitless::MODENUMBER; ++m)
+                                etrans += modeAmplitude[m]
+                                    * math::cos(wavefrontPhase + (2._X * float_X(m) + 1._X) * xi_y + phase) * envelope;
+                            return etrans;
+                        };
+
                         if(Unitless::Polarisation == Unitless::LINEAR_X
                            || Unitless::Polarisation == Unitless::LINEAR_Z)
                         {
-                            for(uint32_t m = 0; m <= Unitless::MODENUMBER; ++m)
-                            {
-                                etrans += typename Unitless::LAGUERREMODES_t{}[m]
-                                    * simpleLaguerre(m, 2.0_X * r2 / w_y / w_y) * math::exp(-r2 / w_y / w_y)
-                                    * math::cos(
-                                              2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * focusPos
-                                              - 2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * r2 / 2.0_X * R_y_inv
-                                              + (2._X * float_X(m) + 1._X) * xi_y + m_phase)
-                                    * math::exp(
-                                              -(r2 / 2.0_X * R_y_inv - focusPos
-                                                - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              * (r2 / 2.0_X * R_y_inv - focusPos
-                                                 - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              / SPEED_OF_LIGHT / SPEED_OF_LIGHT / (2.0_X * Unitless::PULSE_LENGTH)
-                                              / (2.0_X * Unitless::PULSE_LENGTH));
-                            }
-                            this->m_elong *= etrans / etrans_norm;
+                            this->m_elong *= sumModes(m_phase) / etrans_norm;
                         }
                         else if(Unitless::Polarisation == Unitless::CIRCULAR)
                         {
-                            for(uint32_t m = 0; m <= Unitless::MODENUMBER; ++m)
-                            {
-                                etrans += typename Unitless::LAGUERREMODES_t{}[m]
-                                    * simpleLaguerre(m, 2.0_X * r2 / w_y / w_y) * math::exp(-r2 / w_y / w_y)
-                                    * math::cos(
-                                              2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * focusPos
-                                              - 2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * r2 / 2.0_X * R_y_inv
-                                              + (2._X * float_X(m) + 1._X) * xi_y + m_phase)
-                                    * math::exp(
-                                              -(r2 / 2.0_X * R_y_inv - focusPos
-                                                - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              * (r2 / 2.0_X * R_y_inv - focusPos
-                                                 - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              / SPEED_OF_LIGHT / SPEED_OF_LIGHT / (2.0_X * Unitless::PULSE_LENGTH)
-                                              / (2.0_X * Unitless::PULSE_LENGTH));
-                            }
-                            this->m_elong.x() *= etrans / etrans_norm;
+                            this->m_elong.x() *= sumModes(m_phase) / etrans_norm;
                             m_phase += float_X(PI / 2.0);
-                            etrans = 0.0_X;
-                            for(uint32_t m = 0; m <= Unitless::MODENUMBER; ++m)
-                            {
-                                etrans += typename Unitless::LAGUERREMODES_t{}[m]
-                                    * simpleLaguerre(m, 2.0_X * r2 / w_y / w_y) * math::exp(-r2 / w_y / w_y)
-                                    * math::cos(
-                                              2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * focusPos
-                                              - 2.0_X * float_X(PI) / Unitless::WAVE_LENGTH * r2 / 2.0_X * R_y_inv
-                                              + (2._X * float_X(m) + 1._X) * xi_y + m_phase)
-                                    * math::exp(
-                                              -(r2 / 2.0_X * R_y_inv - focusPos
-                                                - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              * (r2 / 2.0_X * R_y_inv - focusPos
-                                                 - m_phase / 2.0_X / float_X(PI) * Unitless::WAVE_LENGTH)
-                                              / SPEED_OF_LIGHT / SPEED_OF_LIGHT / (2.0_X * Unitless::PULSE_LENGTH)
-                                              / (2.0_X * Unitless::PULSE_LENGTH));
-                            }
-                            this->m_elong.z() *= etrans / etrans_norm;
+                            this->m_elong.z() *= sumModes(m_phase) / etrans_norm;
                             // reminder: if you want to use phase below, substract pi/2
                             // m_phase -= float_X( PI / 2.0 );
                         }
@@ -124,9 +124,34 @@ namespace picongpu
 
         void createParticleBuffer();
 
-        //! Push all particles
+        /** Push all particles in an area
+         *
+         * The push can be split to start the particle exchange before the core is pushed:
+         * - BORDER: push the border and shift the particles leaving the local domain into the guard,
+         *           the exchange and the boundary conditions of outer boundaries without offset can
+         *           be applied afterwards
+         * - CORE: push the core, must be called after update<BORDER>() and followed by
+         *         shiftBetweenSupercells() for CORE + BORDER processing only mustShift supercells
+         *         once both pushes are finished
+         * - CORE + BORDER: push and shift all particles
+         *
+         * @tparam T_area area to push
+         * @param currentStep current time iteration
+         */
+        template<uint32_t T_area = CORE + BORDER>
         void update(uint32_t const currentStep);
 
+        /** Push all particles in an area and deposit their current in the same kernel
+         *
+         * Replaces update() followed by FieldJ::computeCurrent() for this species.
+         * Must only be called for species with a current solver.
+         *
+         * @tparam T_area area to push, see update()
+         * @param currentStep current time iteration
+         */
+        template<uint32_t T_area = CORE + BORDER>
+        void updateAndDepositCurrent(uint32_t const currentStep);
+
         /** Update the supercell storage for particles in the area according to particle attributes
          *
          * @tparam T_MapperFactory factory type to construct a mapper that defines the area to process
@@ -209,12 +234,29 @@ namespace picongpu
             return propList;
         }
 
-        template<typename T_Pusher>
+        template<typename T_Pusher, uint32_t T_area>
         void push(uint32_t const currentStep);
 
+        /** Push all particles and deposit their current into fieldJ
+         *
+         * @tparam T_Pusher non-composite pusher type
+         * @tparam T_area area to push, see update()
+         * @param currentStep current time iteration
+         * @param fieldJ current density the current of all particles is added to
+         */
+        template<typename T_Pusher, uint32_t T_area>
+        void push(uint32_t const currentStep, FieldJ& fieldJ);
+
     private:
         SimulationDataId m_datasetID;
 
+        /** Shift the particles of the area pushed by push() between supercells
+         *
+         * @tparam T_area area pushed, see update()
+         */
+        template<uint32_t T_area>
+        void shiftPushedParticles();
+
         /** Get exchange memory size.
          *
          * @param ex exchange index calculated from pmacc::typ::ExchangeType, valid range: [0;27)
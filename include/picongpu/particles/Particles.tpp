@@ -24,14 +24,19 @@
 
 #include "picongpu/fields/FieldB.hpp"
 #include "picongpu/fields/FieldE.hpp"
+#include "picongpu/fields/FieldJ.hpp"
 #include "picongpu/particles/Particles.hpp"
 #include "picongpu/particles/Particles.kernel"
 #include "picongpu/particles/ParticlesInit.kernel"
+#include "picongpu/particles/ParticlesPushAndDeposit.kernel"
 #include "picongpu/particles/boundary/Apply.hpp"
 #include "picongpu/particles/pusher/Traits.hpp"
+#include "picongpu/particles/traits/CanFuseCurrentDeposition.hpp"
+#include "picongpu/particles/traits/GetCurrentSolver.hpp"
 #include "picongpu/particles/traits/GetExchangeMemCfg.hpp"
 #include "picongpu/particles/traits/GetMarginPusher.hpp"
 #include "picongpu/simulation/control/MovingWindow.hpp"
+#include "picongpu/traits/GetMargin.hpp"
 
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/mappings/kernel/AreaMapping.hpp>
@@ -252,44 +257,54 @@ namespace picongpu
     /** Launcher of the particle push
      *
      * @tparam T_Pusher pusher type
+     * @tparam T_area area to push
      * @tparam T_isComposite if the pusher is composite
      */
-    template<typename T_Pusher, bool T_isComposite = particles::pusher::IsComposite<T_Pusher>::value>
+    template<
+        typename T_Pusher,
+        uint32_t T_area,
+        bool T_isComposite = particles::pusher::IsComposite<T_Pusher>::value>
     struct PushLauncher;
 
     /** Launcher of the particle push for non-composite pushers
      *
      * @tparam T_Pusher pusher type
+     * @tparam T_area area to push
      */
-    template<typename T_Pusher>
-    struct PushLauncher<T_Pusher, false>
+    template<typename T_Pusher, uint32_t T_area>
+    struct PushLauncher<T_Pusher, T_area, false>
     {
         /** Launch the pusher for all particles of a species
          *
          * @tparam T_Particles particles type
+         * @tparam T_Args types of the additional arguments
          * @param currentStep current time iteration
+         * @param args additional arguments forwarded to the push method of the species
          */
-        template<typename T_Particles>
-        void operator()(T_Particles&& particles, uint32_t const currentStep) const
+        template<typename T_Particles, typename... T_Args>
+        void operator()(T_Particles&& particles, uint32_t const currentStep, T_Args&&... args) const
         {
-            particles.template push<T_Pusher>(currentStep);
+            particles.template push<T_Pusher, T_area>(currentStep, std::forward<T_Args>(args)...);
         }
     };
 
     /** Launcher of the particle push for composite pushers
      *
      * @tparam T_Pusher pusher type
+     * @tparam T_area area to push
      */
-    template<typename T_CompositePusher>
-    struct PushLauncher<T_CompositePusher, true>
+    template<typename T_CompositePusher, uint32_t T_area>
+    struct PushLauncher<T_CompositePusher, T_area, true>
     {
         /** Launch the pusher for all particles of a species
          *
          * @tparam T_Particles particles type
+         * @tparam T_Args types of the additional arguments
          * @param currentStep current time iteration
+         * @param args additional arguments forwarded to the push method of the species
          */
-        template<typename T_Particles>
-        void operator()(T_Particles&& particles, uint32_t const currentStep) const
+        template<typename T_Particles, typename... T_Args>
+        void operator()(T_Particles&& particles, uint32_t const currentStep, T_Args&&... args) const
         {
             /* Here we check for the active pusher and only call PushLauncher for
              * that one. Note that we still instantiate both templates, but this
@@ -298,19 +313,38 @@ namespace picongpu
              */
             auto activePusherIdx = T_CompositePusher::activePusherIdx(currentStep);
             if(activePusherIdx == 1)
-                PushLauncher<typename T_CompositePusher::FirstPusher>{}(particles, currentStep);
+                PushLauncher<typename T_CompositePusher::FirstPusher, T_area>{}(
+                    particles,
+                    currentStep,
+                    std::forward<T_Args>(args)...);
             else if(activePusherIdx == 2)
-                PushLauncher<typename T_CompositePusher::SecondPusher>{}(particles, currentStep);
+                PushLauncher<typename T_CompositePusher::SecondPusher, T_area>{}(
+                    particles,
+                    currentStep,
+                    std::forward<T_Args>(args)...);
         }
     };
 
     template<typename T_Name, typename T_Flags, typename T_Attributes>
+    template<uint32_t T_area>
     void Particles<T_Name, T_Flags, T_Attributes>::update(uint32_t const currentStep)
     {
         using PusherAlias = typename GetFlagType<FrameType, particlePusher<>>::type;
         using ParticlePush = typename pmacc::traits::Resolve<PusherAlias>::type;
         // Because of composite pushers, we have to defer using the launcher
-        PushLauncher<ParticlePush>{}(*this, currentStep);
+        PushLauncher<ParticlePush, T_area>{}(*this, currentStep);
+    }
+
+    template<typename T_Name, typename T_Flags, typename T_Attributes>
+    template<uint32_t T_area>
+    void Particles<T_Name, T_Flags, T_Attributes>::updateAndDepositCurrent(uint32_t const currentStep)
+    {
+        using PusherAlias = typename GetFlagType<FrameType, particlePusher<>>::type;
+        using ParticlePush = typename pmacc::traits::Resolve<PusherAlias>::type;
+
+        DataConnector& dc = Environment<>::get().DataConnector();
+        auto fieldJ = dc.get<FieldJ>(FieldJ::getName(), true);
+        PushLauncher<ParticlePush, T_area>{}(*this, currentStep, *fieldJ);
     }
 
     template<typename T_Name, typename T_Flags, typename T_Attributes>
@@ -331,7 +365,7 @@ namespace picongpu
      * @param currentStep current time iteration
      */
     template<typename T_Name, typename T_Flags, typename T_Attributes>
-    template<typename T_Pusher>
+    template<typename T_Pusher, uint32_t T_area>
     void Particles<T_Name, T_Flags, T_Attributes>::push(uint32_t const currentStep)
     {
         PMACC_CASSERT_MSG(
@@ -355,7 +389,7 @@ namespace picongpu
 
         using BlockArea = SuperCellDescription<typename MappingDesc::SuperCellSize, LowerMargin, UpperMargin>;
 
-        auto const mapper = makeAreaMapper<CORE + BORDER>(this->cellDescription);
+        auto const mapper = makeAreaMapper<T_area>(this->cellDescription);
 
         constexpr uint32_t numWorkers
             = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
@@ -369,9 +403,93 @@ namespace picongpu
             FrameSolver(),
             mapper);
 
-        // The move-and-mark kernel sets mustShift for supercells, so we can call the optimized version of shift
+        shiftPushedParticles<T_area>();
+    }
+
+    /** Do the particle push stage using the given pusher and deposit the current of the pushed particles
+     *
+     * The current is deposited before the particles are shifted between supercells and before the boundary
+     * conditions are applied.
+     *
+     * @tparam T_Pusher non-composite pusher type
+     * @param currentStep current time iteration
+     * @param fieldJ current density
+     */
+    template<typename T_Name, typename T_Flags, typename T_Attributes>
+    template<typename T_Pusher, uint32_t T_area>
+    void Particles<T_Name, T_Flags, T_Attributes>::push(uint32_t const currentStep, FieldJ& fieldJ)
+    {
+        PMACC_CASSERT_MSG(
+            _internal_error_particle_push_instantiated_for_composite_pusher,
+            particles::pusher::IsComposite<T_Pusher>::type::value == false);
+
+        using InterpolationScheme =
+            typename pmacc::traits::Resolve<typename GetFlagType<FrameType, interpolation<>>::type>::type;
+        using ParticleCurrentSolver =
+            typename pmacc::traits::Resolve<typename GetFlagType<FrameType, current<>>::type>::type;
+
+        using PushFrameSolver = PushParticlePerFrame<T_Pusher, MappingDesc::SuperCellSize, InterpolationScheme>;
+        using CurrentFrameSolver
+            = currentSolver::ComputePerFrame<ParticleCurrentSolver, Velocity, MappingDesc::SuperCellSize>;
+        using FrameSolver = PushAndDepositParticlePerFrame<PushFrameSolver, CurrentFrameSolver>;
+
+        /* all supercells are processed concurrently, a checker board is not possible */
+        using Strategy
+            = currentSolver::strategy::ConcurrentSupercells<currentSolver::traits::GetStrategy_t<CurrentFrameSolver>>;
+
+        DataConnector& dc = Environment<>::get().DataConnector();
+        auto fieldE = dc.get<FieldE>(FieldE::getName(), true);
+        auto fieldB = dc.get<FieldB>(FieldB::getName(), true);
+
+        using LowerMargin = typename GetLowerMarginForPusher<Particles, T_Pusher>::type;
+        using UpperMargin = typename GetUpperMarginForPusher<Particles, T_Pusher>::type;
+
+        using BlockArea = SuperCellDescription<typename MappingDesc::SuperCellSize, LowerMargin, UpperMargin>;
+        using CurrentBlockArea = SuperCellDescription<
+            typename MappingDesc::SuperCellSize,
+            typename GetMargin<ParticleCurrentSolver>::LowerMargin,
+            typename GetMargin<ParticleCurrentSolver>::UpperMargin>;
+
+        // E, B and J are cached in shared memory at the same time, callers fall back to a separate deposition
+        PMACC_CASSERT_MSG(
+            _internal_error_fused_push_and_current_deposition_exceeds_shared_memory,
+            particles::traits::CanFuseCurrentDeposition<Particles>::type::value);
+
+        auto const mapper = makeAreaMapper<T_area>(this->cellDescription);
+
+        constexpr uint32_t numWorkers
+            = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
+
+        PMACC_KERNEL(KernelMoveMarkAndDepositParticles<numWorkers, BlockArea, CurrentBlockArea, Strategy>{})
+        (mapper.getGridDim(), numWorkers)(
+            this->getDeviceParticlesBox(),
+            fieldE->getDeviceDataBox(),
+            fieldB->getDeviceDataBox(),
+            fieldJ.getDeviceDataBox(),
+            currentStep,
+            FrameSolver(CurrentFrameSolver(DELTA_T)),
+            mapper);
+
+        shiftPushedParticles<T_area>();
+    }
+
+    template<typename T_Name, typename T_Flags, typename T_Attributes>
+    template<uint32_t T_area>
+    void Particles<T_Name, T_Flags, T_Attributes>::shiftPushedParticles()
+    {
+        PMACC_CASSERT_MSG(
+            _internal_error_particle_push_area_must_be_CORE_BORDER_or_both,
+            T_area == CORE || T_area == BORDER || T_area == CORE + BORDER);
+
+        // The push kernels set mustShift for supercells, so we can call the optimized version of shift
         auto const onlyProcessMustShiftSupercells = true;
-        shiftBetweenSupercells(pmacc::AreaMapperFactory<CORE + BORDER>{}, onlyProcessMustShiftSupercells);
+        if(T_area == BORDER)
+            ParticlesBaseType::shiftParticlesToGuard();
+        else if(T_area == CORE + BORDER)
+            shiftBetweenSupercells(pmacc::AreaMapperFactory<CORE + BORDER>{}, onlyProcessMustShiftSupercells);
+        /* The core is shifted by the caller together with the remaining border particles
+         * after the border push is finished, see update().
+         */
     }
 
     template<typename T_Name, typename T_Flags, typename T_Attributes>
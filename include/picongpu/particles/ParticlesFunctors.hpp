@@ -24,11 +24,15 @@
 
 #include "picongpu/fields/Fields.def"
 #include "picongpu/particles/boundary/RemoveOuterParticles.hpp"
+#include "picongpu/particles/boundary/Utility.hpp"
+#include "picongpu/particles/traits/CanFuseCurrentDeposition.hpp"
 #include "picongpu/particles/traits/GetIonizerList.hpp"
 
 #include <pmacc/Environment.hpp>
 #include <pmacc/communication/AsyncCommunication.hpp>
 #include <pmacc/math/MapTuple.hpp>
+#include <pmacc/meta/InvokeIf.hpp>
+#include <pmacc/meta/conversion/MakeSeq.hpp>
 #include <pmacc/particles/meta/FindByNameOrType.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 #if(PMACC_CUDA_ENABLED == 1)
@@ -36,6 +40,7 @@
 #endif
 #include "picongpu/particles/creation/creation.hpp"
 #include "picongpu/particles/flylite/IFlyLite.hpp"
+#include "picongpu/particles/ionization/byField/IonizeAndPush.hpp"
 #include "picongpu/particles/synchrotronPhotons/SynchrotronFunctions.hpp"
 #include "picongpu/particles/traits/GetPhotonCreator.hpp"
 
@@ -43,7 +48,9 @@
 #include <pmacc/particles/traits/ResolveAliasFromSpecies.hpp>
 
 #include <boost/mpl/accumulate.hpp>
+#include <boost/mpl/copy_if.hpp>
 #include <boost/mpl/plus.hpp>
+#include <boost/mpl/remove_if.hpp>
 
 #include <memory>
 
@@ -173,6 +180,24 @@ namespace picongpu
             }
         };
 
+        /** Check if the particle exchange of a species can start before its core is pushed
+         *
+         * Boundary conditions of outer boundaries must be applied before the exchange.
+         * With a boundary offset the particles crossing the boundary can be in the core,
+         * without an offset they are all in the guard after the border is pushed.
+         *
+         * @param species particle species
+         */
+        template<typename T_Species>
+        HINLINE bool canOverlapExchange(T_Species const& species)
+        {
+            auto const communicationMask = Environment<simDim>::get().GridController().getCommunicationMask();
+            for(auto exchange : boundary::getAllAxisAlignedExchanges())
+                if(!communicationMask.isSet(exchange) && boundary::getOffsetCells(species, exchange) != 0u)
+                    return false;
+            return true;
+        }
+
         /** Push a species and apply boundary conditions
          *
          * Both operations only affect species with a pusher
@@ -184,21 +209,119 @@ namespace picongpu
         {
             using SpeciesType = pmacc::particles::meta::FindByNameOrType_t<VectorAllSpecies, T_SpeciesType>;
             using FrameType = typename SpeciesType::FrameType;
+            using CanFuseCurrentDeposition = typename traits::CanFuseCurrentDeposition<SpeciesType>::type;
+            using CanMergeIntoPush = typename ionization::CanMergeIntoPush<SpeciesType>::type;
 
+            /** Push the species
+             *
+             * If overlapCommunication is set and canOverlapExchange() holds for the species,
+             * the border is pushed first and the particles leaving the local domain are sent
+             * while the core is pushed. The receive is started by CommunicateSpecies.
+             *
+             * @param currentStep current simulation step
+             * @param eventInt event the push depends on
+             * @param updateEvent[in,out] list the event marking the end of the push is appended to
+             * @param sendEvent[in,out] list the event of the started particle send is appended to,
+             *                          only if the send is started
+             * @param fuseCurrentDeposition deposit the current within the push kernel,
+             *                              ignored if traits::CanFuseCurrentDeposition does not hold
+             * @param overlapCommunication start sending particles before the core is pushed
+             * @param mergeFieldIonization ionize the species within the push if CanMergeIntoPush holds,
+             *                             such species neither fuse the current deposition nor overlap the
+             *                             communication
+             */
             template<typename T_EventList>
-            HINLINE void operator()(const uint32_t currentStep, const EventTask& eventInt, T_EventList& updateEvent)
-                const
+            HINLINE void operator()(
+                const uint32_t currentStep,
+                const EventTask& eventInt,
+                T_EventList& updateEvent,
+                T_EventList& sendEvent,
+                bool const fuseCurrentDeposition,
+                bool const overlapCommunication,
+                bool const mergeFieldIonization) const
             {
                 DataConnector& dc = Environment<>::get().DataConnector();
                 auto species = dc.get<SpeciesType>(FrameType::getName(), true);
 
+                if(isMerged(mergeFieldIonization))
+                {
+                    __startTransaction(eventInt);
+                    /* We have to templatize lambda parameter to defer its instantiation.
+                     * Otherwise it would have been instantiated for species without a suitable ionizer.
+                     */
+                    pmacc::meta::invokeIf<CanMergeIntoPush::value>(
+                        [currentStep](auto speciesPtr) { ionization::ionizeAndPush(*speciesPtr, currentStep); },
+                        species.get());
+                    species->applyBoundary(currentStep);
+                    EventTask ev = __endTransaction();
+                    updateEvent.push_back(ev);
+                    return;
+                }
+
+                if(!overlapCommunication || !canOverlapExchange(*species))
+                {
+                    __startTransaction(eventInt);
+                    push<CORE + BORDER>(*species, currentStep, fuseCurrentDeposition);
+                    // No need to wait here
+                    species->applyBoundary(currentStep);
+                    EventTask ev = __endTransaction();
+                    updateEvent.push_back(ev);
+                    return;
+                }
+
+                // afterwards all particles leaving the local domain are in the guard
                 __startTransaction(eventInt);
-                species->update(currentStep);
-                // No need to wait here
+                push<BORDER>(*species, currentStep, fuseCurrentDeposition);
                 species->applyBoundary(currentStep);
+                EventTask borderEvent = __endTransaction();
+
+                __startTransaction(borderEvent);
+                Environment<>::get().ParticleFactory().createTaskParticlesSend(*species);
+                sendEvent.push_back(__endTransaction());
+
+                // the core push does not touch border and guard supercells and runs concurrently to the send
+                __startTransaction(eventInt);
+                push<CORE>(*species, currentStep, fuseCurrentDeposition);
+                __setTransactionEvent(__getTransactionEvent() + borderEvent);
+                // shift the core together with the border particles staying in the local domain
+                auto const onlyProcessMustShiftSupercells = true;
+                species->shiftBetweenSupercells(
+                    pmacc::AreaMapperFactory<CORE + BORDER>{},
+                    onlyProcessMustShiftSupercells);
                 EventTask ev = __endTransaction();
                 updateEvent.push_back(ev);
             }
+
+            /** Check if the species is ionized within the push
+             *
+             * @param mergeFieldIonization must be the value the push is called with
+             */
+            HINLINE static bool isMerged(bool const mergeFieldIonization)
+            {
+                return mergeFieldIonization && CanMergeIntoPush::value;
+            }
+
+        private:
+            template<uint32_t T_area>
+            HINLINE static void push(
+                SpeciesType& species,
+                const uint32_t currentStep,
+                bool const fuseCurrentDeposition)
+            {
+                if(fuseCurrentDeposition && CanFuseCurrentDeposition::value)
+                {
+                    /* We have to templatize lambda parameter to defer its instantiation.
+                     * Otherwise it would have been instantiated for species without a current solver
+                     * or with caches exceeding the shared memory.
+                     */
+                    pmacc::meta::invokeIf<CanFuseCurrentDeposition::value>(
+                        [currentStep](auto speciesPtr)
+                        { speciesPtr->template updateAndDepositCurrent<T_area>(currentStep); },
+                        &species);
+                }
+                else
+                    species.template update<T_area>(currentStep);
+            }
         };
 
         /** Remove all particles of the species that are outside the respective boundaries
@@ -233,8 +356,22 @@ namespace picongpu
             using SpeciesType = pmacc::particles::meta::FindByNameOrType_t<VectorAllSpecies, T_SpeciesType>;
             using FrameType = typename SpeciesType::FrameType;
 
+            /** Start the communication
+             *
+             * @param updateEventList[in,out] push events of the species, the first one is consumed
+             * @param sendEventList[in,out] events of sends started by PushSpecies,
+             *                              the first one is consumed if the send of this species was started
+             * @param commEventList[in,out] list the event of the communication is appended to
+             * @param overlapCommunication must be the value PushSpecies was called with
+             * @param mergeFieldIonization must be the value PushSpecies was called with
+             */
             template<typename T_EventList>
-            HINLINE void operator()(T_EventList& updateEventList, T_EventList& commEventList) const
+            HINLINE void operator()(
+                T_EventList& updateEventList,
+                T_EventList& sendEventList,
+                T_EventList& commEventList,
+                bool const overlapCommunication,
+                bool const mergeFieldIonization) const
             {
                 DataConnector& dc = Environment<>::get().DataConnector();
                 auto species = dc.get<SpeciesType>(FrameType::getName(), true);
@@ -242,7 +379,20 @@ namespace picongpu
                 EventTask updateEvent(*(updateEventList.begin()));
 
                 updateEventList.pop_front();
-                commEventList.push_back(communication::asyncCommunication(*species, updateEvent));
+                bool const isMerged = PushSpecies<SpeciesType>::isMerged(mergeFieldIonization);
+                if(overlapCommunication && !isMerged && canOverlapExchange(*species))
+                {
+                    EventTask sendEvent(*(sendEventList.begin()));
+                    sendEventList.pop_front();
+
+                    // received particles are inserted into the border, wait until all particles are shifted
+                    __startTransaction(updateEvent);
+                    Environment<>::get().ParticleFactory().createTaskParticlesReceive(*species);
+                    EventTask receiveEvent = __endTransaction();
+                    commEventList.push_back(receiveEvent + sendEvent);
+                }
+                else
+                    commEventList.push_back(communication::asyncCommunication(*species, updateEvent));
             }
         };
 
@@ -254,22 +404,43 @@ namespace picongpu
              * @param currentStep current simulation step
              * @param pushEvent[out] grouped event that marks the end of the species push
              * @param commEvent[out] grouped event that marks the end of the species communication
+             * @param fuseCurrentDeposition deposit the current of species with a current solver within the push
+             * @param overlapCommunication push the border first and send the leaving particles while the core is
+             *                             pushed
+             * @param mergeFieldIonization ionize species supporting it within the push
              */
             HINLINE void operator()(
                 const uint32_t currentStep,
                 const EventTask& eventInt,
                 EventTask& pushEvent,
-                EventTask& commEvent) const
+                EventTask& commEvent,
+                bool const fuseCurrentDeposition = false,
+                bool const overlapCommunication = false,
+                bool const mergeFieldIonization = false) const
             {
                 using EventList = std::list<EventTask>;
                 EventList updateEventList;
+                EventList sendEventList;
                 EventList commEventList;
 
-                /* push all species */
+                /* push all species
+                 * species which can be ionized within the push come first, the particles they create
+                 * must be pushed afterwards
+                 */
                 using VectorSpeciesWithPusher =
                     typename pmacc::particles::traits::FilterByFlag<VectorAllSpecies, particlePusher<>>::type;
-                meta::ForEach<VectorSpeciesWithPusher, PushSpecies<bmpl::_1>> pushSpecies;
-                pushSpecies(currentStep, eventInt, updateEventList);
+                using VectorSpeciesPushOrder = pmacc::MakeSeq_t<
+                    typename bmpl::copy_if<VectorSpeciesWithPusher, ionization::CanMergeIntoPush<bmpl::_1>>::type,
+                    typename bmpl::remove_if<VectorSpeciesWithPusher, ionization::CanMergeIntoPush<bmpl::_1>>::type>;
+                meta::ForEach<VectorSpeciesPushOrder, PushSpecies<bmpl::_1>> pushSpecies;
+                pushSpecies(
+                    currentStep,
+                    eventInt,
+                    updateEventList,
+                    sendEventList,
+                    fuseCurrentDeposition,
+                    overlapCommunication,
+                    mergeFieldIonization);
 
                 /* join all push events */
                 for(auto iter = updateEventList.begin(); iter != updateEventList.end(); ++iter)
@@ -278,8 +449,13 @@ namespace picongpu
                 }
 
                 /* call communication for all species */
-                meta::ForEach<VectorSpeciesWithPusher, particles::CommunicateSpecies<bmpl::_1>> communicateSpecies;
-                communicateSpecies(updateEventList, commEventList);
+                meta::ForEach<VectorSpeciesPushOrder, particles::CommunicateSpecies<bmpl::_1>> communicateSpecies;
+                communicateSpecies(
+                    updateEventList,
+                    sendEventList,
+                    commEventList,
+                    overlapCommunication,
+                    mergeFieldIonization);
 
                 /* join all communication events */
                 for(auto iter = commEventList.begin(); iter != commEventList.end(); ++iter)
@@ -372,12 +548,21 @@ namespace picongpu
              *                           that is later passed to the kernel
              * @param cellDesc logical block information like dimension and cell sizes
              * @param currentStep The current time step
+             * @param skipMergedSpecies do nothing if the species is ionized within the push,
+             *                          see ionization::CanMergeIntoPush
              */
             template<typename T_CellDescription>
-            HINLINE void operator()(T_CellDescription cellDesc, const uint32_t currentStep) const
+            HINLINE void operator()(
+                T_CellDescription cellDesc,
+                const uint32_t currentStep,
+                bool const skipMergedSpecies = false) const
             {
                 DataConnector& dc = Environment<>::get().DataConnector();
 
+                using CanMergeIntoPush = typename ionization::CanMergeIntoPush<SpeciesType>::type;
+                if(skipMergedSpecies && CanMergeIntoPush::value)
+                    return;
+
                 // only if an ionizer has been specified, this is executed
                 using hasIonizers = typename HasFlag<FrameType, ionizers<>>::type;
                 if(hasIonizers::value)
@@ -87,6 +87,7 @@ namespace picongpu
                     T_ParBox0 pb0,
                     T_ParBox1 pb1,
                     T_Mapping const mapper,
+                    detail::ListPoolBox const listPoolBox,
                     T_DeviceHeapHandle deviceHeapHandle,
                     T_RngHandle rngHandle,
                     T_CollisionFunctor const collisionFunctor,
@@ -106,7 +107,9 @@ namespace picongpu
                     PMACC_SMEM(acc, nppc, memory::Array<uint32_t, frameSize>);
 
                     PMACC_SMEM(acc, parCellList0, memory::Array<detail::ListEntry, frameSize>);
+                    PMACC_SMEM(acc, listChunk0, detail::ListChunk);
                     PMACC_SMEM(acc, parCellList1, memory::Array<detail::ListEntry, frameSize>);
+                    PMACC_SMEM(acc, listChunk1, detail::ListChunk);
                     PMACC_SMEM(acc, densityArray0, memory::Array<float_X, frameSize>);
                     PMACC_SMEM(acc, densityArray1, memory::Array<float_X, frameSize>);
 
@@ -137,11 +140,14 @@ namespace picongpu
                     FramePtr0 firstFrame0 = pb0.getFirstFrame(superCellIdx);
                     prepareList(
                         acc,
+                        workerIdx,
                         forEachFrameElem,
+                        listPoolBox,
                         deviceHeapHandle,
                         pb0,
                         firstFrame0,
                         numParticlesInSupercell0,
+                        listChunk0,
                         parCellList0,
                         nppc,
                         accFilter0);
@@ -149,11 +155,14 @@ namespace picongpu
                     FramePtr1 firstFrame1 = pb1.getFirstFrame(superCellIdx);
                     prepareList(
                         acc,
+                        workerIdx,
                         forEachFrameElem,
+                        listPoolBox,
                         deviceHeapHandle,
                         pb1,
                         firstFrame1,
                         numParticlesInSupercell1,
+                        listChunk1,
                         parCellList1,
                         nppc,
                         accFilter1);
@@ -233,10 +242,8 @@ namespace picongpu
 
                     cupla::__syncthreads(acc);
 
-                    forEachFrameElem([&](uint32_t const linearIdx) {
-                        parCellList0[linearIdx].finalize(acc, deviceHeapHandle);
-                        parCellList1[linearIdx].finalize(acc, deviceHeapHandle);
-                    });
+                    listChunk0.finalize(acc, workerIdx, deviceHeapHandle);
+                    listChunk1.finalize(acc, workerIdx, deviceHeapHandle);
                 }
 
 
@@ -315,7 +322,8 @@ namespace picongpu
             {
                 /* Run kernel
                  *
-                 * @param deviceHeap A pointer to device heap for allocating particle lists.
+                 * @param deviceHeap A pointer to device heap for allocating particle lists if the list pool is
+                 *     exhausted.
                  * @param currentStep The current simulation step.
                  */
                 HINLINE void operator()(const std::shared_ptr<DeviceHeap>& deviceHeap, uint32_t currentStep)
@@ -334,6 +342,7 @@ namespace picongpu
                     DataConnector& dc = Environment<>::get().DataConnector();
                     auto species0 = dc.get<Species0>(FrameType0::getName(), true);
                     auto species1 = dc.get<Species1>(FrameType1::getName(), true);
+                    auto listPool = dc.get<detail::ListPool>(detail::ListPool::getName(), true);
 
                     // Use mapping information from the first species:
                     auto const mapper = makeAreaMapper<CORE + BORDER>(species0->getCellDescription());
@@ -350,6 +359,7 @@ namespace picongpu
                         species0->getDeviceParticlesBox(),
                         species1->getDeviceParticlesBox(),
                         mapper,
+                        listPool->getDeviceBox(),
                         deviceHeap->getAllocatorHandle(),
                         RNGFactory::createHandle(),
                         CollisionFunctor(currentStep),
@@ -76,6 +76,7 @@ namespace picongpu
                     T_Acc const& acc,
                     T_ParBox pb,
                     T_Mapping const mapper,
+                    detail::ListPoolBox const listPoolBox,
                     T_DeviceHeapHandle deviceHeapHandle,
                     T_RngHandle rngHandle,
                     T_CollisionFunctor const collisionFunctor,
@@ -93,6 +94,7 @@ namespace picongpu
                     PMACC_SMEM(acc, nppc, memory::Array<uint32_t, frameSize>);
 
                     PMACC_SMEM(acc, parCellList, memory::Array<detail::ListEntry, frameSize>);
+                    PMACC_SMEM(acc, listChunk, detail::ListChunk);
 
                     PMACC_SMEM(acc, densityArray, memory::Array<float_X, frameSize>);
 
@@ -119,11 +121,14 @@ namespace picongpu
 
                     prepareList(
                         acc,
+                        workerIdx,
                         forEachFrameElem,
+                        listPoolBox,
                         deviceHeapHandle,
                         pb,
                         firstFrame,
                         numParticlesInSupercell,
+                        listChunk,
                         parCellList,
                         nppc,
                         accFilter);
@@ -178,8 +183,7 @@ namespace picongpu
 
                     cupla::__syncthreads(acc);
 
-                    forEachFrameElem(
-                        [&](uint32_t const linearIdx) { parCellList[linearIdx].finalize(acc, deviceHeapHandle); });
+                    listChunk.finalize(acc, workerIdx, deviceHeapHandle);
                 }
             };
 
@@ -203,7 +207,8 @@ namespace picongpu
             {
                 /* Run kernel
                  *
-                 * @param deviceHeap A pointer to device heap for allocating particle lists.
+                 * @param deviceHeap A pointer to device heap for allocating particle lists if the list pool is
+                 *     exhausted.
                  * @param currentStep The current simulation step.
                  */
                 void operator()(const std::shared_ptr<DeviceHeap>& deviceHeap, uint32_t currentStep)
@@ -215,6 +220,7 @@ namespace picongpu
 
                     DataConnector& dc = Environment<>::get().DataConnector();
                     auto species = dc.get<Species>(FrameType::getName(), true);
+                    auto listPool = dc.get<detail::ListPool>(detail::ListPool::getName(), true);
 
                     auto const mapper = makeAreaMapper<CORE + BORDER>(species->getCellDescription());
 
@@ -228,6 +234,7 @@ namespace picongpu
                     (mapper.getGridDim(), numWorkers)(
                         species->getDeviceParticlesBox(),
                         mapper,
+                        listPool->getDeviceBox(),
                         deviceHeap->getAllocatorHandle(),
                         RNGFactory::createHandle(),
                         CollisionFunctor(currentStep),
@@ -21,6 +21,9 @@
 
 #include "picongpu/simulation_defines.hpp"
 
+#include "picongpu/particles/collision/detail/ListPool.hpp"
+
+#include <pmacc/lockstep.hpp>
 #include <pmacc/random/distributions/Uniform.hpp>
 
 namespace picongpu
@@ -31,90 +34,81 @@ namespace picongpu
         {
             namespace detail
             {
-                /* Storage for particle IDs.
+                /* Allocate storage for particle IDs on the device heap.
                  *
-                 * Storage for IDs of collision eligible macro particles. It comes with a simple
-                 * shuffling algorithm.
+                 * @param acc alpaka accelerator
+                 * @param deviceHeapHandle Heap handle used for allocating storage on device.
+                 * @param numPar number of IDs to be stored, must be > 0
                  */
-                struct ListEntry
+                template<typename T_Acc, typename T_DeviceHeapHandle>
+                DINLINE uint32_t* allocateOnHeap(
+                    T_Acc const& acc,
+                    T_DeviceHeapHandle& deviceHeapHandle,
+                    uint32_t const numPar)
                 {
-                    //! Size of the particle list (number of stored IDs).
-                    uint32_t size;
-                    //! Pointer to the actual data stored on the device heap.
-                    uint32_t* ptrToIndicies;
-
-                    /* Initialize storage, allocate memory.
-                     *
-                     * @param acc alpaka accelerator
-                     * @param deviceHeapHandle Heap handle used for allocating storage on device.
-                     * @param numPar maximal number of IDs to be stored in the list.
-                     */
-                    template<typename T_acc, typename T_DeviceHeapHandle>
-                    DINLINE void init(T_acc const& acc, T_DeviceHeapHandle& deviceHeapHandle, uint32_t numPar)
+                    uint32_t* ptr = nullptr;
+                    const int maxTries = 13; // magic number is not performance critical
+                    for(int numTries = 0; numTries < maxTries; ++numTries)
                     {
-                        ptrToIndicies = nullptr;
-                        if(numPar != 0u)
-                        {
-                            const int maxTries = 13; // magic number is not performance critical
-                            for(int numTries = 0; numTries < maxTries; ++numTries)
-                            {
 #if(BOOST_LANG_CUDA || BOOST_COMP_HIP) // Allocate memory on a GPU device
-                                ptrToIndicies = (uint32_t*) deviceHeapHandle.malloc(acc, sizeof(uint32_t) * numPar);
+                        ptr = (uint32_t*) deviceHeapHandle.malloc(acc, sizeof(uint32_t) * numPar);
 #else // No cuda or hip means the device heap is the host heap.
-                                ptrToIndicies = new uint32_t[numPar];
+                        ptr = new uint32_t[numPar];
 #endif
-                                if(ptrToIndicies != nullptr)
-                                {
-                                    break;
-                                }
-                                else
-                                {
+                        if(ptr != nullptr)
+                        {
+                            break;
+                        }
+                        else
+                        {
 #ifndef BOOST_COMP_HIP
-                                    // TODO: took it from ParticleBox.hpp but HIP should support printf, though
-                                    // maby only with HCC_ENABLE_PRINTF set.
-                                    printf(
-                                        "%s in collisions:  mallocMC out of memory (try %i of %i)\n",
-                                        (numTries + 1) == maxTries ? "ERROR" : "WARNING",
-                                        numTries + 1,
-                                        maxTries);
+                            // TODO: took it from ParticleBox.hpp but HIP should support printf, though
+                            // maby only with HCC_ENABLE_PRINTF set.
+                            printf(
+                                "%s in collisions:  mallocMC out of memory (try %i of %i)\n",
+                                (numTries + 1) == maxTries ? "ERROR" : "WARNING",
+                                numTries + 1,
+                                maxTries);
 #endif
-                                }
-                            }
-                            if(ptrToIndicies == nullptr)
-                            {
+                        }
+                    }
+                    if(ptr == nullptr)
+                    {
 #if BOOST_COMP_HIP
-                                // do nothing
+                        // do nothing
 #elif BOOST_LANG_CUDA
-                                __trap();
+                        __trap();
 #else
-                                throw std::runtime_error("Out of memory in collisions.");
+                        throw std::runtime_error("Out of memory in collisions.");
 #endif
-                            }
-                        }
-                        // reset counter
-                        size = 0u;
                     }
+                    return ptr;
+                }
 
-                    /* Release allocated heap memory.
+                /* Storage for particle IDs.
+                 *
+                 * Storage for IDs of collision eligible macro particles. It comes with a simple
+                 * shuffling algorithm.
+                 * The memory is owned by the ListChunk of the supercell.
+                 */
+                struct ListEntry
+                {
+                    //! Size of the particle list (number of stored IDs).
+                    uint32_t size;
+                    //! Pointer to the actual data stored in the ListChunk of the supercell.
+                    uint32_t* ptrToIndicies;
+
+                    /* Initialize an empty list.
                      *
-                     * @param acc alpaka accelerator
-                     * @param deviceHeapHandle Heap handle used for allocating storage on device.
+                     * @param ptr storage for the IDs, can hold all eligible particles of the cell
                      */
-                    template<typename T_acc, typename T_DeviceHeapHandle>
-                    DINLINE void finalize(T_acc const& acc, T_DeviceHeapHandle& deviceHeapHandle)
+                    DINLINE void init(uint32_t* ptr)
                     {
-                        if(ptrToIndicies != nullptr)
-                        {
-#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
-                            deviceHeapHandle.free(acc, (void*) ptrToIndicies);
-                            ptrToIndicies = nullptr;
-#else
-                            delete(ptrToIndicies);
-#endif
-                        }
+                        ptrToIndicies = ptr;
+                        // reset counter
+                        size = 0u;
                     }
 
-
                     /* Shuffle list entries.
                      *
                      * @param acc alpaka accelerator
@@ -152,6 +146,104 @@ namespace picongpu
                     }
                 };
 
+                /* Storage for the particle ID lists of all cells in a supercell.
+                 *
+                 * The lists are stored back-to-back in one chunk, taken from the ListPool.
+                 * Only if the pool is exhausted the chunk is allocated on the device heap.
+                 * Must be placed in shared memory.
+                 */
+                struct ListChunk
+                {
+                    //! storage of all lists, nullptr if there is no eligible particle
+                    uint32_t* ptr;
+                    //! number of IDs in the chunk
+                    uint32_t size;
+                    //! chunk is allocated on the device heap
+                    bool isOnHeap;
+
+                    /* Allocate the chunk and distribute it to the lists of the cells.
+                     *
+                     * @param acc alpaka accelerator
+                     * @param workerIdx index of the worker
+                     * @param forEach lockstep for each over all cells of the supercell
+                     * @param listPoolBox device handle of the ListPool
+                     * @param deviceHeapHandle Heap handle used if the pool is exhausted.
+                     * @param parCellList lists of the cells
+                     * @param nppc number of eligible particles per cell, overwritten with the offset of the cell
+                     *             list within the chunk
+                     */
+                    template<
+                        typename T_Acc,
+                        typename T_ForEach,
+                        typename T_DeviceHeapHandle,
+                        typename T_EntryListArray,
+                        typename T_Array>
+                    DINLINE void init(
+                        T_Acc const& acc,
+                        uint32_t const workerIdx,
+                        T_ForEach forEach,
+                        ListPoolBox const& listPoolBox,
+                        T_DeviceHeapHandle& deviceHeapHandle,
+                        T_EntryListArray& parCellList,
+                        T_Array& nppc)
+                    {
+                        auto onlyMaster = lockstep::makeMaster(workerIdx);
+
+                        onlyMaster([&]() { size = 0u; });
+                        cupla::__syncthreads(acc);
+
+                        forEach([&](uint32_t const linearIdx) {
+                            nppc[linearIdx]
+                                = cupla::atomicAdd(acc, &size, nppc[linearIdx], ::alpaka::hierarchy::Threads{});
+                        });
+                        cupla::__syncthreads(acc);
+
+                        onlyMaster([&]() {
+                            ptr = nullptr;
+                            isOnHeap = false;
+                            if(size != 0u)
+                            {
+                                ptr = listPoolBox.allocate(acc, size);
+                                if(ptr == nullptr)
+                                {
+                                    ptr = allocateOnHeap(acc, deviceHeapHandle, size);
+                                    isOnHeap = true;
+                                }
+                            }
+                        });
+                        cupla::__syncthreads(acc);
+
+                        forEach([&](uint32_t const linearIdx) { parCellList[linearIdx].init(ptr + nppc[linearIdx]); });
+                    }
+
+                    /* Release the chunk if it is allocated on the device heap.
+                     *
+                     * Must be called by all workers after all lists are processed.
+                     *
+                     * @param acc alpaka accelerator
+                     * @param workerIdx index of the worker
+                     * @param deviceHeapHandle Heap handle used for allocating storage on device.
+                     */
+                    template<typename T_Acc, typename T_DeviceHeapHandle>
+                    DINLINE void finalize(
+                        T_Acc const& acc,
+                        uint32_t const workerIdx,
+                        T_DeviceHeapHandle& deviceHeapHandle)
+                    {
+                        lockstep::makeMaster(workerIdx)([&]() {
+                            if(isOnHeap && ptr != nullptr)
+                            {
+#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
+                                deviceHeapHandle.free(acc, (void*) ptr);
+#else
+                                delete[] ptr;
+#endif
+                            }
+                            ptr = nullptr;
+                        });
+                    }
+                };
+
                 // TODO: simplify (maybe crate a class and inject all the required stuff as private references?), Check
                 // const, & etc.
                 //! Counting particles per grid frame
@@ -255,11 +347,14 @@ namespace picongpu
                     typename T_Filter>
                 DINLINE void prepareList(
                     T_Acc const& acc,
+                    uint32_t const workerIdx,
                     T_ForEach forEach,
+                    ListPoolBox const& listPoolBox,
                     T_DeviceHeapHandle deviceHeapHandle,
                     T_ParBox& parBox,
                     T_FramePtr firstFrame,
                     uint32_t const numParticlesInSupercell,
+                    ListChunk& listChunk,
                     T_EntryListArray& parCellList,
                     T_Array& nppc,
                     T_Filter filter)
@@ -272,9 +367,7 @@ namespace picongpu
                     cupla::__syncthreads(acc);
 
                     // memory for particle indices
-                    forEach([&](uint32_t const linearIdx) {
-                        parCellList[linearIdx].init(acc, deviceHeapHandle, nppc[linearIdx]);
-                    });
+                    listChunk.init(acc, workerIdx, forEach, listPoolBox, deviceHeapHandle, parCellList, nppc);
                     cupla::__syncthreads(acc);
 
                     detail::updateLinkedList(
@@ -0,0 +1,231 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/dataManagement/ISimulationData.hpp>
+#include <pmacc/memory/buffers/DeviceBufferIntern.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+
+
+namespace picongpu
+{
+    namespace particles
+    {
+        namespace collision
+        {
+            namespace detail
+            {
+                /** Device side handle of the ListPool
+                 *
+                 * The pool is a linear bump allocator, reset once per time step.
+                 */
+                struct ListPoolBox
+                {
+                    //! pool memory
+                    uint32_t* data;
+                    //! number of particle indices which fit into data
+                    uint32_t capacity;
+                    /** number of particle indices requested in the current time step
+                     *
+                     * Also counts requests exceeding the capacity, which is used to grow the pool.
+                     * The counter is 64 bit, therefore it can not wrap around within a time step.
+                     */
+                    uint64_cu* numRequested;
+
+                    /** Take storage for particle indices from the pool
+                     *
+                     * @param acc alpaka accelerator
+                     * @param numIndices number of particle indices to store, must be > 0
+                     * @return pointer to the storage, nullptr if the pool is exhausted
+                     */
+                    template<typename T_Acc>
+                    DINLINE uint32_t* allocate(T_Acc const& acc, uint32_t const numIndices) const
+                    {
+                        uint64_cu const offset = cupla::atomicAdd(
+                            acc,
+                            numRequested,
+                            static_cast<uint64_cu>(numIndices),
+                            ::alpaka::hierarchy::Blocks{});
+                        if(offset + numIndices > capacity)
+                            return nullptr;
+                        return data + offset;
+                    }
+                };
+
+                /** Persistent storage for the particle index lists of the binary collisions
+                 *
+                 * The collision kernels take the lists of a supercell from this pool instead of the device heap.
+                 * The pool is sized by the number of indices requested in an earlier time step and is grown
+                 * only if the demand increases. Requests which do not fit fall back to the device heap.
+                 *
+                 * The demand is read back asynchronously, the host never waits for the collision kernels.
+                 * Two device counters are used alternately, a counter is only reset after its value arrived
+                 * on the host.
+                 */
+                class ListPool : public ISimulationData
+                {
+                public:
+                    ListPool()
+                    {
+                        for(auto& counter : m_numRequested)
+                            counter = std::make_unique<DeviceBufferIntern<uint64_cu, DIM1>>(DataSpace<DIM1>(1));
+                        CUDA_CHECK(cuplaMallocHost((void**) &m_hostNumRequested, sizeof(uint64_cu)));
+                        CUDA_CHECK(cuplaEventCreateWithFlags(&m_readbackEvent, cuplaEventDisableTiming));
+                    }
+
+                    ~ListPool() override
+                    {
+                        CUDA_CHECK_NO_EXCEPT(cuplaEventSynchronize(m_readbackEvent));
+                        CUDA_CHECK_NO_EXCEPT(cuplaEventDestroy(m_readbackEvent));
+                        CUDA_CHECK_NO_EXCEPT(cuplaFreeHost(m_hostNumRequested));
+                    }
+
+                    static std::string getName()
+                    {
+                        return "CollisionListPool";
+                    }
+
+                    SimulationDataId getUniqueId() override
+                    {
+                        return getName();
+                    }
+
+                    void synchronize() override
+                    {
+                    }
+
+                    //! start a new time step, must be called before the first collision kernel of the step
+                    void reset()
+                    {
+                        // the counter whose read back is pending must not be reset
+                        if(m_isReadbackPending)
+                            m_counter = (m_readbackCounter + 1u) % numCounters;
+                        m_numRequested[m_counter]->setValue(0u);
+                    }
+
+                    //! get the device side handle
+                    ListPoolBox getDeviceBox()
+                    {
+                        return ListPoolBox{
+                            m_data ? m_data->getPointer() : nullptr,
+                            m_capacity,
+                            m_numRequested[m_counter]->getPointer()};
+                    }
+
+                    /** Start the read back of the demand of the current time step
+                     *
+                     * Must be called after the last collision kernel of the step.
+                     * Grows the pool if the demand of an earlier step arrived on the host and exceeds the
+                     * capacity, without waiting for the device.
+                     * While a read back is pending, the demand of further steps is not read.
+                     */
+                    void update()
+                    {
+                        if(m_isReadbackPending)
+                        {
+                            cuplaError_t const rc = cuplaEventQuery(m_readbackEvent);
+                            if(rc == cuplaErrorNotReady)
+                                return;
+                            CUDA_CHECK(rc);
+                            m_isReadbackPending = false;
+                            grow(*m_hostNumRequested);
+                        }
+
+                        // enqueue behind the collision kernels of this step
+                        cuplaStream_t const stream = __getEventStream(ITask::TASK_DEVICE)->getCudaStream();
+                        CUDA_CHECK(cuplaMemcpyAsync(
+                            m_hostNumRequested,
+                            m_numRequested[m_counter]->getPointer(),
+                            sizeof(uint64_cu),
+                            cuplaMemcpyDeviceToHost,
+                            stream));
+                        CUDA_CHECK(cuplaEventRecord(m_readbackEvent, stream));
+                        m_readbackCounter = m_counter;
+                        m_isReadbackPending = true;
+                    }
+
+                private:
+                    /** Grow the pool to a demand
+                     *
+                     * The memory reserved for plugins (reservedGpuMemorySize) is not touched and the pool takes
+                     * at most half of the remaining free device memory, the remaining requests are served by the
+                     * device heap.
+                     *
+                     * @param numRequested number of particle indices requested within one time step
+                     */
+                    void grow(uint64_t const numRequested)
+                    {
+                        if(numRequested <= m_capacity)
+                            return;
+
+                        // headroom to avoid a reallocation for every small increase of the demand
+                        uint64_t newCapacity = numRequested + numRequested / 8u;
+                        // limited by the int extent of the buffer
+                        newCapacity = std::min(newCapacity, uint64_t(std::numeric_limits<int>::max()));
+
+                        // the current pool is freed before the new one is allocated
+                        size_t freeMemory = 0u;
+                        Environment<>::get().MemoryInfo().getMemoryInfo(&freeMemory);
+                        freeMemory += size_t(m_capacity) * sizeof(uint32_t);
+                        if(freeMemory <= reservedGpuMemorySize)
+                            return;
+                        size_t const poolMemory = (freeMemory - reservedGpuMemorySize) / 2u;
+                        newCapacity = std::min(newCapacity, uint64_t(poolMemory / sizeof(uint32_t)));
+                        if(newCapacity <= m_capacity)
+                            return;
+
+                        log<picLog::MEMORY>("collision: grow particle list pool from %1% to %2% MiB")
+                            % (uint64_t(m_capacity) * sizeof(uint32_t) / 1024u / 1024u)
+                            % (newCapacity * sizeof(uint32_t) / 1024u / 1024u);
+                        // waits for the collision kernels still using the pool
+                        m_data.reset();
+                        m_data = std::make_unique<DeviceBufferIntern<uint32_t, DIM1>>(
+                            DataSpace<DIM1>(static_cast<int>(newCapacity)));
+                        m_capacity = static_cast<uint32_t>(newCapacity);
+                    }
+
+                    static constexpr uint32_t numCounters = 2u;
+
+                    //! demand counters, used alternately
+                    std::unique_ptr<DeviceBufferIntern<uint64_cu, DIM1>> m_numRequested[numCounters];
+                    //! index of the counter of the current time step
+                    uint32_t m_counter = 0u;
+                    //! index of the counter which is read back
+                    uint32_t m_readbackCounter = 0u;
+                    //! pinned host memory the demand is read back into
+                    uint64_cu* m_hostNumRequested = nullptr;
+                    //! marks the end of the read back
+                    cuplaEvent_t m_readbackEvent;
+                    bool m_isReadbackPending = false;
+                    std::unique_ptr<DeviceBufferIntern<uint32_t, DIM1>> m_data;
+                    uint32_t m_capacity = 0u;
+                };
+            } // namespace detail
+        } // namespace collision
+    } // namespace particles
+} // namespace picongpu
@@ -142,6 +142,32 @@ namespace picongpu
                     cupla::__syncthreads(acc);
                 }
 
+                /** use fields cached by the caller instead of caching them
+                 *
+                 * Replaces collectiveInit() if the caller already loaded E for BlockArea into
+                 * shared memory with the ids used by collectiveInit() and synchronized the block,
+                 * see UsePushFieldCache.
+                 *
+                 * @tparam T_Acc alpaka accelerator type
+                 * @tparam T_WorkerCfg lockstep::Worker, configuration of the worker
+                 *
+                 * @param acc alpaka accelerator
+                 * @param blockCell relative offset (in cells) to the local domain plus the guarding cells
+                 * @param workerCfg configuration of the worker
+                 */
+                template<typename T_Acc, typename T_WorkerCfg>
+                DINLINE void collectiveInitFromCache(
+                    const T_Acc& acc,
+                    const DataSpace<simDim>& blockCell,
+                    const T_WorkerCfg& workerCfg)
+                {
+                    /* shift origin of jbox to supercell of particle */
+                    jBox = jBox.shift(blockCell);
+
+                    /* E is already in shared memory */
+                    cachedE = CachedBox::create<1, ValueType_E>(acc, BlockArea());
+                }
+
                 /** Initialization function on device
                  *
                  * \brief Cache EM-fields on device
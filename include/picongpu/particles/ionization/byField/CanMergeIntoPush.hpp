@@ -0,0 +1,119 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/particles/ionization/byField/UsePushFieldCache.hpp"
+#include "picongpu/particles/pusher/Traits.hpp"
+#include "picongpu/particles/traits/GetIonizerList.hpp"
+#include "picongpu/particles/traits/GetPusher.hpp"
+#include "picongpu/traits/GetMargin.hpp"
+
+#include <pmacc/math/vector/compile-time/Int.hpp>
+#include <pmacc/math/vector/compile-time/Vector.hpp>
+#include <pmacc/traits/HasFlag.hpp>
+
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/front.hpp>
+#include <boost/mpl/size.hpp>
+
+#include <type_traits>
+
+
+namespace picongpu
+{
+    namespace particles
+    {
+        namespace ionization
+        {
+            namespace detail
+            {
+                //! check the ionizer, only instantiated for a single ionizer
+                template<typename T_IonizerList, bool T_isSingleIonizer = bmpl::size<T_IonizerList>::type::value == 1>
+                struct IsSingleIonizerUsingPushFieldCache : std::false_type
+                {
+                };
+
+                template<typename T_IonizerList>
+                struct IsSingleIonizerUsingPushFieldCache<T_IonizerList, true>
+                    : UsePushFieldCache<typename bmpl::front<T_IonizerList>::type>
+                {
+                };
+
+                //! check the pusher, the fields the ionizer caches must cover the interpolation of the pusher
+                template<typename T_Pusher, bool T_isComposite = pusher::IsComposite<T_Pusher>::type::value>
+                struct IsMarginFreePusher : std::false_type
+                {
+                };
+
+                template<typename T_Pusher>
+                struct IsMarginFreePusher<T_Pusher, false>
+                {
+                    using OneCell = typename pmacc::math::CT::make_Int<simDim, 1>::type;
+                    using LowerMargin = typename picongpu::traits::GetLowerMargin<T_Pusher>::type;
+                    using UpperMargin = typename picongpu::traits::GetUpperMargin<T_Pusher>::type;
+                    // a margin is zero if adding one cell in each direction gives a single cell
+                    using LowerArea = typename pmacc::math::CT::add<LowerMargin, OneCell>::type;
+                    using UpperArea = typename pmacc::math::CT::add<UpperMargin, OneCell>::type;
+
+                    static constexpr bool value = pmacc::math::CT::volume<LowerArea>::type::value == 1
+                        && pmacc::math::CT::volume<UpperArea>::type::value == 1;
+                };
+
+                //! check the species, ionizers and pusher are only accessed if the species has both flags
+                template<
+                    typename T_Species,
+                    bool T_hasIonizersAndPusher
+                    = pmacc::traits::HasFlag<typename T_Species::FrameType, ionizers<>>::type::value
+                        && pmacc::traits::HasFlag<typename T_Species::FrameType, particlePusher<>>::type::value>
+                struct CanMergeIntoPush : std::false_type
+                {
+                };
+
+                template<typename T_Species>
+                struct CanMergeIntoPush<T_Species, true>
+                    : std::integral_constant<
+                          bool,
+                          IsSingleIonizerUsingPushFieldCache<
+                              typename particles::traits::GetIonizerList<T_Species>::type>::value
+                              && IsMarginFreePusher<typename picongpu::traits::GetPusher<T_Species>::type>::value>
+                {
+                };
+            } // namespace detail
+
+            /** Check if the field ionization of a species can be merged into its push
+             *
+             * This is the case if the species has exactly one ionizer which uses the fields cached by the pusher,
+             * see UsePushFieldCache, and a non-composite pusher which needs no fields beyond the margins of the
+             * interpolation.
+             *
+             * @tparam T_Species particle species type
+             * @treturn ::type boost::mpl::bool_
+             */
+            template<typename T_Species>
+            struct CanMergeIntoPush
+            {
+                using type = bmpl::bool_<detail::CanMergeIntoPush<T_Species>::value>;
+            };
+
+        } // namespace ionization
+    } // namespace particles
+} // namespace picongpu
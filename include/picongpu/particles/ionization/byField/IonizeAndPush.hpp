@@ -0,0 +1,112 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/fields/FieldB.hpp"
+#include "picongpu/fields/FieldE.hpp"
+#include "picongpu/particles/ionization/byField/CanMergeIntoPush.hpp"
+#include "picongpu/particles/ionization/byField/IonizeAndPush.kernel"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/traits/GetFlagType.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include <pmacc/traits/Resolve.hpp>
+
+#include <boost/mpl/front.hpp>
+
+#include <cstdint>
+
+
+namespace picongpu
+{
+    namespace particles
+    {
+        namespace ionization
+        {
+            /** Ionize and push a species with a single kernel
+             *
+             * Replaces the ionization of the species by its ionizer followed by Particles::update().
+             * The created particles are not pushed, their species must be pushed afterwards.
+             *
+             * @tparam T_Species particle species type, CanMergeIntoPush must be true
+             * @param species species to ionize and push
+             * @param currentStep current time iteration
+             */
+            template<typename T_Species>
+            HINLINE void ionizeAndPush(T_Species& species, uint32_t const currentStep)
+            {
+                PMACC_CASSERT_MSG(
+                    _internal_error_ionization_can_not_be_merged_into_push_for_this_species,
+                    CanMergeIntoPush<T_Species>::type::value);
+
+                using FrameType = typename T_Species::FrameType;
+                using IonizerList = typename particles::traits::GetIonizerList<T_Species>::type;
+                using Ionizer = typename bmpl::front<IonizerList>::type;
+                using DestSpecies = typename Ionizer::DestSpecies;
+                using DestFrameType = typename DestSpecies::FrameType;
+
+                using Pusher = typename picongpu::traits::GetPusher<T_Species>::type;
+                using InterpolationScheme =
+                    typename pmacc::traits::Resolve<typename GetFlagType<FrameType, interpolation<>>::type>::type;
+                using FrameSolver = PushParticlePerFrame<Pusher, MappingDesc::SuperCellSize, InterpolationScheme>;
+
+                // the pusher has no margins, so the area of the push is the area of the ionizer
+                using BlockArea = typename Ionizer::BlockArea;
+
+                DataConnector& dc = Environment<>::get().DataConnector();
+                auto fieldE = dc.get<FieldE>(FieldE::getName(), true);
+                auto fieldB = dc.get<FieldB>(FieldB::getName(), true);
+                auto electrons = dc.get<DestSpecies>(DestFrameType::getName(), true);
+
+                auto const mapper = makeAreaMapper<CORE + BORDER>(species.getCellDescription());
+
+                constexpr uint32_t numWorkers
+                    = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
+
+                PMACC_KERNEL(KernelIonizeMoveAndMarkParticles<numWorkers, BlockArea>{})
+                (mapper.getGridDim(), numWorkers)(
+                    species.getDeviceParticlesBox(),
+                    electrons->getDeviceParticlesBox(),
+                    fieldE->getDeviceDataBox(),
+                    fieldB->getDeviceDataBox(),
+                    currentStep,
+                    Ionizer(currentStep),
+                    FrameSolver(),
+                    mapper);
+
+                // the push kernel sets mustShift for supercells, so we can call the optimized version of shift
+                auto const onlyProcessMustShiftSupercells = true;
+                species.shiftBetweenSupercells(
+                    pmacc::AreaMapperFactory<CORE + BORDER>{},
+                    onlyProcessMustShiftSupercells);
+
+                /* fill the gaps in the created species' particle frames to ensure that only
+                 * the last frame is not completely filled but every other before is full
+                 */
+                electrons->fillAllGaps();
+            }
+
+        } // namespace ionization
+    } // namespace particles
+} // namespace picongpu
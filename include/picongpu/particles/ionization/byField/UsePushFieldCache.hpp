@@ -0,0 +1,49 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+
+namespace picongpu
+{
+    namespace particles
+    {
+        namespace ionization
+        {
+            /** Check if an ionizer can read its fields from the cache of the particle pusher
+             *
+             * Such an ionizer caches B with id 0 and E with id 1 for the interpolation margins of the
+             * species, like KernelMoveAndMarkParticles, and provides collectiveInitFromCache().
+             * An ionizer opts in by specializing this trait next to the forward declaration of its
+             * implementation in the ionizer's .def file.
+             * The .def files are included with the species definitions, therefore the trait gives the
+             * same result everywhere, even while the ionizer implementation is still incomplete.
+             *
+             * @tparam T_Ionizer ionizer type
+             */
+            template<typename T_Ionizer>
+            struct UsePushFieldCache : std::false_type
+            {
+            };
+
+        } // namespace ionization
+    } // namespace particles
+} // namespace picongpu
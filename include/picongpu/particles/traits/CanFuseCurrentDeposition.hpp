@@ -0,0 +1,149 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/fields/currentDeposition/Esirkepov/Esirkepov.def"
+#include "picongpu/fields/currentDeposition/Strategy.def"
+#include "picongpu/particles/traits/GetCurrentSolver.hpp"
+#include "picongpu/particles/traits/GetMarginPusher.hpp"
+#include "picongpu/traits/GetMargin.hpp"
+
+#include <pmacc/math/vector/compile-time/Vector.hpp>
+#include <pmacc/traits/GetMaxStaticSharedMemBytes.hpp>
+#include <pmacc/traits/HasFlag.hpp>
+
+#include <boost/mpl/bool.hpp>
+
+#include <cstddef>
+#include <type_traits>
+
+
+namespace picongpu
+{
+    namespace particles
+    {
+        namespace traits
+        {
+            namespace detail
+            {
+                template<
+                    typename T_Species,
+                    bool T_hasPusherAndCurrentSolver
+                    = pmacc::traits::HasFlag<typename T_Species::FrameType, particlePusher<>>::type::value
+                        && pmacc::traits::HasFlag<typename T_Species::FrameType, current<>>::type::value>
+                struct GetFusedPushSharedMemBytes
+                {
+                    static constexpr size_t value = 0u;
+                };
+
+                template<typename T_Species>
+                struct GetFusedPushSharedMemBytes<T_Species, true>
+                {
+                    using ParticleCurrentSolver = typename picongpu::traits::GetCurrentSolver<T_Species>::type;
+                    using Strategy = currentSolver::traits::GetStrategy_t<ParticleCurrentSolver>;
+
+                    // margins of composite pushers cover both pushers
+                    using FieldArea = SuperCellDescription<
+                        typename MappingDesc::SuperCellSize,
+                        typename picongpu::traits::GetLowerMarginPusher<T_Species>::type,
+                        typename picongpu::traits::GetUpperMarginPusher<T_Species>::type>;
+                    using CurrentArea = SuperCellDescription<
+                        typename MappingDesc::SuperCellSize,
+                        typename picongpu::traits::GetMargin<ParticleCurrentSolver>::LowerMargin,
+                        typename picongpu::traits::GetMargin<ParticleCurrentSolver>::UpperMargin>;
+
+                    // E, B and J are float3_X
+                    static constexpr size_t value
+                        = pmacc::math::CT::volume<typename FieldArea::FullSuperCellSize>::type::value * 2u
+                            * sizeof(float3_X)
+                        + (Strategy::useBlockCache
+                               ? pmacc::math::CT::volume<typename CurrentArea::FullSuperCellSize>::type::value
+                                   * sizeof(float3_X)
+                               : 0u);
+                };
+
+                /** Check if a current solver only writes within its margins
+                 *
+                 * EsirkepovNative loops over [-LowerMargin, UpperMargin] and can write one cell beyond the
+                 * upper margin, which would be outside of the J cache of the fused kernel.
+                 */
+                template<typename T_CurrentSolver>
+                struct IsWithinMarginCurrentSolver : std::true_type
+                {
+                };
+
+                template<typename T_ParticleShape, typename T_Strategy>
+                struct IsWithinMarginCurrentSolver<currentSolver::EsirkepovNative<T_ParticleShape, T_Strategy>>
+                    : std::false_type
+                {
+                };
+
+                template<
+                    typename T_Species,
+                    bool T_hasCurrentSolver
+                    = pmacc::traits::HasFlag<typename T_Species::FrameType, current<>>::type::value>
+                struct IsWithinMarginCurrentDeposition : std::false_type
+                {
+                };
+
+                template<typename T_Species>
+                struct IsWithinMarginCurrentDeposition<T_Species, true>
+                    : IsWithinMarginCurrentSolver<typename picongpu::traits::GetCurrentSolver<T_Species>::type>
+                {
+                };
+            } // namespace detail
+
+            /** Get the shared memory of the E, B and J caches of the fused push and current deposition
+             *
+             * @tparam T_Species particle species type
+             * @return @p ::value number of bytes, zero for species without pusher or current solver
+             */
+            template<typename T_Species>
+            struct GetFusedPushSharedMemBytes
+            {
+                static constexpr size_t value = detail::GetFusedPushSharedMemBytes<T_Species>::value;
+            };
+
+            /** Check if a species can deposit its current within the push kernel
+             *
+             * The species needs a pusher and a current solver which only writes within its margins and the
+             * E, B and J caches must fit into the statically allocated shared memory of the accelerator together.
+             * A small reserve is kept for the other shared variables of the kernel.
+             *
+             * @tparam T_Species particle species type
+             * @treturn ::type boost::mpl::bool_
+             */
+            template<typename T_Species>
+            struct CanFuseCurrentDeposition
+            {
+                static constexpr size_t reservedSharedMemBytes = 1024u;
+                static constexpr size_t sharedMemBytes = GetFusedPushSharedMemBytes<T_Species>::value;
+
+                using type = bmpl::bool_<
+                    sharedMemBytes != 0u && detail::IsWithinMarginCurrentDeposition<T_Species>::value
+                    && sharedMemBytes + reservedSharedMemBytes
+                        <= pmacc::traits::GetMaxStaticSharedMemBytes<cupla::AccThreadSeq>::value>;
+            };
+
+        } // namespace traits
+    } // namespace particles
+} // namespace picongpu
@@ -39,6 +39,7 @@
 #include <pmacc/math/operation.hpp>
 #include <pmacc/memory/shared/Allocate.hpp>
 #include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/mpi/reduceMethods/IReduce.hpp>
 #include <pmacc/mpi/reduceMethods/Reduce.hpp>
 #include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
@@ -334,6 +335,16 @@ namespace picongpu
 
         mpi::MPIReduce reduce;
 
+        /** request of the pending reduce of the histogram
+         *
+         * The reduce is started in notify() and completed and written at the next notify(), before a checkpoint or
+         * at the end of the simulation.
+         */
+        MPI_Request reduceRequest = MPI_REQUEST_NULL;
+
+        //! time step of the pending reduce
+        uint32_t reduceStep = 0u;
+
         std::shared_ptr<Help> m_help;
         size_t m_id;
 
@@ -392,6 +403,7 @@ namespace picongpu
 
         void notify(uint32_t currentStep) override
         {
+            finishReduce();
             calBinEnergyParticles<CORE + BORDER>(currentStep);
         }
 
@@ -405,12 +417,20 @@ namespace picongpu
 
         void checkpoint(uint32_t currentStep, std::string const& checkpointDirectory) override
         {
+            // the text file is copied, the line of a pending reduce must be written before
+            finishReduce();
             if(!writeToFile)
                 return;
 
             checkpointTxtFile(outFile, filename, currentStep, checkpointDirectory);
         }
 
+        //! write the result of a reduce which is still pending
+        void pluginUnload() override
+        {
+            finishReduce();
+        }
+
     private:
         /* Open a New Output File
          *
@@ -481,8 +501,22 @@ namespace picongpu
                 binReduced.data(),
                 gBins->getHostBuffer().getBasePointer(),
                 realNumBins,
-                mpi::reduceMethods::Reduce());
+                mpi::reduceMethods::IReduce(&reduceRequest));
+            reduceStep = currentStep;
+        }
+
+        /** Wait for the pending reduce of the histogram and write it to the file
+         *
+         * The reduce started in notify() is completed by the next notify(), by checkpoint() before
+         * the text file is copied and, at the end of the simulation, by pluginUnload().
+         * All of them are called by all MPI ranks while MPI is initialized.
+         */
+        void finishReduce()
+        {
+            if(reduceRequest == MPI_REQUEST_NULL)
+                return;
 
+            MPI_CHECK(MPI_Wait(&reduceRequest, MPI_STATUS_IGNORE));
 
             if(writeToFile)
             {
@@ -492,7 +526,7 @@ namespace picongpu
 
                 /* write data to file */
                 float_64 count_particles = 0.0;
-                outFile << currentStep << " " << std::scientific; /*  for floating points, ignored for ints */
+                outFile << reduceStep << " " << std::scientific; /*  for floating points, ignored for ints */
 
                 for(int i = 0; i < realNumBins; ++i)
                 {
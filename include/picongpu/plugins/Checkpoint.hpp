@@ -101,7 +101,11 @@ namespace picongpu
                      **/
                     "checkpoint.restart.chunkSize",
                     po::value<uint32_t>(&restartChunkSize)->default_value(1000000u),
-                    "Number of particles processed in one kernel call during restart to prevent frame count blowup");
+                    "Number of particles processed in one kernel call during restart to prevent frame count blowup")(
+                    "checkpoint.fullPeriod",
+                    po::value<uint32_t>(&fullPeriod)->default_value(0u),
+                    "Every n-th checkpoint is a full checkpoint, the checkpoints in between contain only data which "
+                    "changed since the last full checkpoint and require it for a restart (0 = only full checkpoints)");
 
             for(auto& backend : ioBackendsHelp)
                 backend.second->expandHelp(desc, "checkpoint.");
@@ -126,7 +130,9 @@ namespace picongpu
             auto cBackend = ioBackends.find(checkpointBackendName);
             if(cBackend != ioBackends.end())
             {
-                cBackend->second->dumpCheckpoint(currentStep, checkpointDirectory, checkpointFilename);
+                bool const incremental = fullPeriod != 0u && numCheckpoints % fullPeriod != 0u;
+                cBackend->second->dumpCheckpoint(currentStep, checkpointDirectory, checkpointFilename, incremental);
+                ++numCheckpoints;
             }
         }
 
@@ -164,6 +170,10 @@ namespace picongpu
                 else
                     ioBackends[checkpointBackendName] = std::static_pointer_cast<IIOBackend>(
                         cBackendHelp->second->create(cBackendHelp->second, 0, m_cellDescription));
+
+                // checked before the simulation starts if checkpoints are written to node-local directories
+                Environment<>::get().SimulationDescription().setNodeLocalCheckpointMergeable(
+                    ioBackends[checkpointBackendName]->isNodeLocalCheckpointMergeable());
             }
             // create restart backend
             if(!ioBackendsHelp.empty() && checkpointBackendName != restartBackendName)
@@ -208,6 +218,15 @@ namespace picongpu
          */
         uint32_t restartChunkSize{0u};
 
+        /** period of full checkpoints in number of checkpoints
+         *
+         * Checkpoints in between are incremental, 0 disables incremental checkpoints.
+         */
+        uint32_t fullPeriod{0u};
+
+        //! number of checkpoints written by this run, a run always starts with a full checkpoint
+        uint32_t numCheckpoints{0u};
+
         // can be "openPMD"
         std::map<std::string, std::shared_ptr<IIOBackend>> ioBackends;
 
@@ -24,6 +24,7 @@
 #include "common/txtFileHandling.hpp"
 #include "picongpu/particles/filter/filter.hpp"
 #include "picongpu/plugins/ISimulationPlugin.hpp"
+#include "picongpu/plugins/misc/SpeciesSweep.hpp"
 
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/math/operation.hpp>
@@ -34,6 +35,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
 
 
@@ -60,6 +62,9 @@ namespace picongpu
 
         mpi::MPIReduce reduce;
 
+        //! particle sweep providing the number of particles, shared with other plugins
+        std::shared_ptr<plugins::misc::SpeciesSweep<ParticlesType>> sweep;
+
     public:
         CountParticles()
             : pluginName("CountParticles: count macro particles of a species")
@@ -100,7 +105,8 @@ namespace picongpu
         {
             if(!notifyPeriod.empty())
             {
-                writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+                sweep = plugins::misc::SpeciesSweep<ParticlesType>::get();
+                writeToFile = sweep->hasResult();
 
                 if(writeToFile)
                 {
@@ -132,6 +138,7 @@ namespace picongpu
                         std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
                     outFile.close();
                 }
+                sweep.reset();
             }
         }
 
@@ -154,35 +161,33 @@ namespace picongpu
         template<uint32_t AREA>
         void countParticles(uint32_t currentStep)
         {
-            uint64_cu size;
+            // the number of particles is shared with other plugins requesting all particles on this step
+            auto const& sums = sweep->getSums(currentStep, particles::filter::All::getName(), *cellDescription);
+            uint64_cu const reducedValue = sums.numMacroParticles;
 
-            const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
-            const DataSpace<simDim> localSize(subGrid.getLocalDomain().size);
+            uint64_cu reducedValueMax;
+            if(picLog::log_level & picLog::CRITICAL::lvl)
+            {
+                const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+                const DataSpace<simDim> localSize(subGrid.getLocalDomain().size);
 
-            DataConnector& dc = Environment<>::get().DataConnector();
-            auto particles = dc.get<ParticlesType>(ParticlesType::FrameType::getName(), true);
+                DataConnector& dc = Environment<>::get().DataConnector();
+                auto particles = dc.get<ParticlesType>(ParticlesType::FrameType::getName(), true);
 
-            // enforce that the filter interface is fulfilled
-            particles::filter::IUnary<particles::filter::All> parFilter{currentStep};
+                // enforce that the filter interface is fulfilled
+                particles::filter::IUnary<particles::filter::All> parFilter{currentStep};
 
-            /*count local particles*/
-            size = pmacc::CountParticles::countOnDevice<AREA>(
-                *particles,
-                *cellDescription,
-                DataSpace<simDim>(),
-                localSize,
-                parFilter);
+                /*count local particles*/
+                uint64_cu size = pmacc::CountParticles::countOnDevice<AREA>(
+                    *particles,
+                    *cellDescription,
+                    DataSpace<simDim>(),
+                    localSize,
+                    parFilter);
 
-            uint64_cu reducedValueMax;
-            if(picLog::log_level & picLog::CRITICAL::lvl)
-            {
                 reduce(pmacc::math::operation::Max(), &reducedValueMax, &size, 1, mpi::reduceMethods::Reduce());
             }
 
-
-            uint64_cu reducedValue;
-            reduce(pmacc::math::operation::Add(), &reducedValue, &size, 1, mpi::reduceMethods::Reduce());
-
             if(writeToFile)
             {
                 if(picLog::log_level & picLog::CRITICAL::lvl)
@@ -50,6 +50,7 @@
 #include <boost/mpl/and.hpp>
 
 #include <algorithm>
+#include <array>
 #include <fstream>
 #include <iostream>
 #include <memory>
@@ -438,6 +439,12 @@ namespace picongpu
             gCount_e
                 = std::make_unique<GridBuffer<float_64, DIM1>>(DataSpace<DIM1>(subGrid.getLocalDomain().size.y()));
 
+            using ReducedBuffer = container::HostBuffer<float_64, DIM1>;
+            reducedSumMom2 = std::make_unique<ReducedBuffer>(subGrid.getLocalDomain().size.y());
+            reducedSumPos2 = std::make_unique<ReducedBuffer>(subGrid.getLocalDomain().size.y());
+            reducedSumMomPos = std::make_unique<ReducedBuffer>(subGrid.getLocalDomain().size.y());
+            reducedCount_e = std::make_unique<ReducedBuffer>(subGrid.getLocalDomain().size.y());
+
             // only MPI rank that writes to file
             if(writeToFile)
             {
@@ -475,6 +482,7 @@ namespace picongpu
          */
         void notify(uint32_t currentStep) override
         {
+            finishReduce();
             // call the method that calls the plugin kernel
             calculateCalcEmittance<CORE + BORDER>(currentStep);
         }
@@ -490,12 +498,20 @@ namespace picongpu
 
         void checkpoint(uint32_t currentStep, std::string const& checkpointDirectory) override
         {
+            // the text file is copied, the line of a pending reduce must be written before
+            finishReduce();
             if(!writeToFile)
                 return;
 
             checkpointTxtFile(outFile, filename, currentStep, checkpointDirectory);
         }
 
+        //! write the result of a reduce which is still pending
+        void pluginUnload() override
+        {
+            finishReduce();
+        }
+
     private:
         //! method to call analysis and plugin-kernel calls
         template<uint32_t AREA>
@@ -523,7 +539,6 @@ namespace picongpu
             DataSpace<simDim> localSize(m_cellDescription->getGridLayout().getDataSpaceWithoutGuarding());
             const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
             const int subGridY = subGrid.getGlobalDomain().size.y();
-            auto movingWindow = MovingWindow::getInstance().getWindow(currentStep);
             DataSpace<simDim> globalOffset(subGrid.getLocalDomain().offset);
 
             auto binaryKernel = std::bind(
@@ -549,36 +564,52 @@ namespace picongpu
             gSumMomPos->deviceToHost();
             gCount_e->deviceToHost();
 
-            container::HostBuffer<float_64, DIM1> reducedSumMom2(subGrid.getLocalDomain().size.y());
-            container::HostBuffer<float_64, DIM1> reducedSumPos2(subGrid.getLocalDomain().size.y());
-            container::HostBuffer<float_64, DIM1> reducedSumMomPos(subGrid.getLocalDomain().size.y());
-            container::HostBuffer<float_64, DIM1> reducedCount_e(subGrid.getLocalDomain().size.y());
-            reducedSumMom2.assign(0.0);
-            reducedSumPos2.assign(0.0);
-            reducedSumMomPos.assign(0.0);
-            reducedCount_e.assign(0.0);
-
-            // add gSum values from all GPUs using MPI
-            planeReduce->template operator()(/* parameters: dest, source */
-                                             reducedSumMom2,
-                                             gSumMom2->getHostBuffer().cartBuffer(),
-                                             /* the functors return value will be written to dst */
-                                             pmacc::algorithm::functor::Add());
-            planeReduce->template operator()(/* parameters: dest, source */
-                                             reducedSumPos2,
-                                             gSumPos2->getHostBuffer().cartBuffer(),
-                                             /* the functors return value will be written to dst */
-                                             pmacc::algorithm::functor::Add());
-            planeReduce->template operator()(/* parameters: dest, source */
-                                             reducedSumMomPos,
-                                             gSumMomPos->getHostBuffer().cartBuffer(),
-                                             /* the functors return value will be written to dst */
-                                             pmacc::algorithm::functor::Add());
-            planeReduce->template operator()(/* parameters: dest, source */
-                                             reducedCount_e,
-                                             gCount_e->getHostBuffer().cartBuffer(),
-                                             /* the functors return value will be written to dst */
-                                             pmacc::algorithm::functor::Add());
+            reducedSumMom2->assign(0.0);
+            reducedSumPos2->assign(0.0);
+            reducedSumMomPos->assign(0.0);
+            reducedCount_e->assign(0.0);
+
+            // avoid reducing data which is not yet copied from the device
+            __getTransactionEvent().waitForFinished();
+
+            // add gSum values from all GPUs using MPI, the reduce is completed in finishReduce()
+            reduceRequests[0] = planeReduce->startReduce(
+                *reducedSumMom2,
+                gSumMom2->getHostBuffer().cartBuffer(),
+                pmacc::algorithm::functor::Add());
+            reduceRequests[1] = planeReduce->startReduce(
+                *reducedSumPos2,
+                gSumPos2->getHostBuffer().cartBuffer(),
+                pmacc::algorithm::functor::Add());
+            reduceRequests[2] = planeReduce->startReduce(
+                *reducedSumMomPos,
+                gSumMomPos->getHostBuffer().cartBuffer(),
+                pmacc::algorithm::functor::Add());
+            reduceRequests[3] = planeReduce->startReduce(
+                *reducedCount_e,
+                gCount_e->getHostBuffer().cartBuffer(),
+                pmacc::algorithm::functor::Add());
+            reduceStep = currentStep;
+            isReducePending = true;
+        }
+
+        /** Wait for the pending reduce, gather the planes and write the emittance to the file
+         *
+         * The reduce started in notify() is completed by the next notify(), by checkpoint() before
+         * the text file is copied and, at the end of the simulation, by pluginUnload().
+         * All of them are called by all MPI ranks while MPI is initialized.
+         */
+        void finishReduce()
+        {
+            if(!isReducePending)
+                return;
+            isReducePending = false;
+
+            MPI_CHECK(MPI_Waitall(reduceRequests.size(), reduceRequests.data(), MPI_STATUSES_IGNORE));
+
+            uint32_t const currentStep = reduceStep;
+            const SubGrid<simDim>& subGrid = Environment<simDim>::get().SubGrid();
+            auto movingWindow = MovingWindow::getInstance().getWindow(currentStep);
 
             /** all non-reduce-root processes are done now */
             if(!isPlaneReduceRoot)
@@ -605,7 +636,7 @@ namespace picongpu
             std::vector<int> recvcounts(gatherSize, 1);
 
             MPI_CHECK(MPI_Gatherv(
-                reducedSumMom2.getDataPointer(),
+                reducedSumMom2->getDataPointer(),
                 subGrid.getLocalDomain().size.y(),
                 MPI_DOUBLE,
                 globalSumMom2.getDataPointer(),
@@ -615,7 +646,7 @@ namespace picongpu
                 0,
                 commGather));
             MPI_CHECK(MPI_Gatherv(
-                reducedSumPos2.getDataPointer(),
+                reducedSumPos2->getDataPointer(),
                 subGrid.getLocalDomain().size.y(),
                 MPI_DOUBLE,
                 globalSumPos2.getDataPointer(),
@@ -625,7 +656,7 @@ namespace picongpu
                 0,
                 commGather));
             MPI_CHECK(MPI_Gatherv(
-                reducedSumMomPos.getDataPointer(),
+                reducedSumMomPos->getDataPointer(),
                 subGrid.getLocalDomain().size.y(),
                 MPI_DOUBLE,
                 globalSumMomPos.getDataPointer(),
@@ -635,7 +666,7 @@ namespace picongpu
                 0,
                 commGather));
             MPI_CHECK(MPI_Gatherv(
-                reducedCount_e.getDataPointer(),
+                reducedCount_e->getDataPointer(),
                 subGrid.getLocalDomain().size.y(),
                 MPI_DOUBLE,
                 globalCount_e.getDataPointer(),
@@ -745,6 +776,28 @@ namespace picongpu
 
         std::unique_ptr<GridBuffer<float_64, DIM1>> gCount_e;
 
+        //! plane reduced values, only valid on the plane reduce roots
+        std::unique_ptr<container::HostBuffer<float_64, DIM1>> reducedSumMom2;
+
+        std::unique_ptr<container::HostBuffer<float_64, DIM1>> reducedSumPos2;
+
+        std::unique_ptr<container::HostBuffer<float_64, DIM1>> reducedSumMomPos;
+
+        std::unique_ptr<container::HostBuffer<float_64, DIM1>> reducedCount_e;
+
+        /** requests of the pending plane reduce
+         *
+         * The reduce is started in notify() and completed and written at the next notify(), before a checkpoint or
+         * at the end of the simulation.
+         */
+        std::array<MPI_Request, 4> reduceRequests;
+
+        //! true if a reduce was started but is not completed
+        bool isReducePending = false;
+
+        //! time step of the pending reduce
+        uint32_t reduceStep = 0u;
+
         MappingDesc* m_cellDescription = nullptr;
 
         //! output file name
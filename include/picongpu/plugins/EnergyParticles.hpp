@@ -22,22 +22,13 @@
 
 #include "picongpu/simulation_defines.hpp"
 
-#include "picongpu/algorithms/KinEnergy.hpp"
-#include "picongpu/particles/traits/GenerateSolversIfSpeciesEligible.hpp"
 #include "picongpu/particles/traits/SpeciesEligibleForSolver.hpp"
 #include "picongpu/plugins/common/txtFileHandling.hpp"
+#include "picongpu/plugins/misc/SpeciesSweep.hpp"
 #include "picongpu/plugins/misc/misc.hpp"
 #include "picongpu/plugins/multi/multi.hpp"
 
-#include <pmacc/dataManagement/DataConnector.hpp>
-#include <pmacc/lockstep.hpp>
-#include <pmacc/mappings/kernel/AreaMapping.hpp>
-#include <pmacc/math/operation.hpp>
-#include <pmacc/memory/shared/Allocate.hpp>
 #include <pmacc/meta/ForEach.hpp>
-#include <pmacc/mpi/MPIReduce.hpp>
-#include <pmacc/mpi/reduceMethods/Reduce.hpp>
-#include <pmacc/traits/GetNumWorkers.hpp>
 #include <pmacc/traits/HasFlag.hpp>
 #include <pmacc/traits/HasIdentifiers.hpp>
 
@@ -45,6 +36,7 @@
 
 #include <fstream>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <stdexcept>
 #include <string>
@@ -52,142 +44,6 @@
 
 namespace picongpu
 {
-    /** accumulate the kinetic and total energy
-     *
-     * All energies are summed over all particles of a species.
-     *
-     * @tparam T_numWorkers number of workers
-     */
-    template<uint32_t T_numWorkers>
-    struct KernelEnergyParticles
-    {
-        /** accumulate particle energies
-         *
-         * @tparam T_ParBox pmacc::ParticlesBox, particle box type
-         * @tparam T_DBox pmacc::DataBox, type of the memory box for the reduced energies
-         * @tparam T_Mapping mapper functor type
-         *
-         * @param pb particle memory
-         * @param gEnergy storage for the reduced energies
-         *                (two elements 0 == kinetic; 1 == total energy)
-         * @param mapper functor to map a block to a supercell
-         */
-        template<typename T_ParBox, typename T_DBox, typename T_Mapping, typename T_Acc, typename T_Filter>
-        DINLINE void operator()(T_Acc const& acc, T_ParBox pb, T_DBox gEnergy, T_Mapping mapper, T_Filter filter) const
-        {
-            constexpr uint32_t numWorkers = T_numWorkers;
-            constexpr uint32_t numParticlesPerFrame
-                = pmacc::math::CT::volume<typename T_ParBox::FrameType::SuperCellSize>::type::value;
-
-            uint32_t const workerIdx = cupla::threadIdx(acc).x;
-
-            using FramePtr = typename T_ParBox::FramePtr;
-
-            // shared kinetic energy
-            PMACC_SMEM(acc, shEnergyKin, float_X);
-            // shared total energy
-            PMACC_SMEM(acc, shEnergy, float_X);
-
-            // sum kinetic energy for all particles touched by the virtual thread
-            float_X localEnergyKin(0.0);
-            float_X localEnergy(0.0);
-
-            auto masterOnly = lockstep::makeMaster(workerIdx);
-
-            masterOnly([&]() {
-                // set shared kinetic energy to zero
-                shEnergyKin = float_X(0.0);
-                // set shared total energy to zero
-                shEnergy = float_X(0.0);
-            });
-
-            cupla::__syncthreads(acc);
-
-            DataSpace<simDim> const superCellIdx(mapper.getSuperCellIndex(DataSpace<simDim>(cupla::blockIdx(acc))));
-
-            // each virtual thread is working on an own frame
-            FramePtr frame = pb.getLastFrame(superCellIdx);
-
-            // end kernel if we have no frames within the supercell
-            if(!frame.isValid())
-                return;
-
-            auto accFilter
-                = filter(acc, superCellIdx - mapper.getGuardingSuperCells(), lockstep::Worker<numWorkers>{workerIdx});
-
-            auto forEachParticleInFrame = lockstep::makeForEach<numParticlesPerFrame, numWorkers>(workerIdx);
-
-            auto currentParticleCtx = forEachParticleInFrame(
-
-                [&](uint32_t const linearIdx) -> typename FramePtr::type::ParticleType {
-                    auto particle = frame[linearIdx];
-                    /* - only particles from the last frame must be checked
-                     * - all other particles are always valid
-                     */
-                    if(particle[multiMask_] != 1)
-                        particle.setHandleInvalid();
-                    return particle;
-                });
-
-            while(frame.isValid())
-            {
-                // loop over all particles in the frame
-                forEachParticleInFrame([&](lockstep::Idx const idx) {
-                    /* get one particle */
-                    auto& particle = currentParticleCtx[idx];
-                    if(accFilter(acc, particle))
-                    {
-                        float3_X const mom = particle[momentum_];
-                        // compute square of absolute momentum of the particle
-                        float_X const mom2 = pmacc::math::abs2(mom);
-                        float_X const weighting = particle[weighting_];
-                        float_X const mass = attribute::getMass(weighting, particle);
-                        float_X const c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
-
-                        // calculate kinetic energy of the macro particle
-                        localEnergyKin += KinEnergy<>()(mom, mass);
-
-                        /* total energy for particles:
-                         *    E^2 = p^2*c^2 + m^2*c^4
-                         *        = c^2 * [p^2 + m^2*c^2]
-                         */
-                        localEnergy += math::sqrt(mom2 + mass * mass * c2) * SPEED_OF_LIGHT;
-                    }
-                });
-
-                // set frame to next particle frame
-                frame = pb.getPreviousFrame(frame);
-                forEachParticleInFrame([&](lockstep::Idx const idx) {
-                    /* Update particle for the next round.
-                     * The frame list is traverse from the last to the first frame.
-                     * Only the last frame can contain gaps therefore all following
-                     * frames are filled with fully particles.
-                     */
-                    currentParticleCtx[idx] = frame[idx];
-                });
-            }
-
-            // each virtual thread adds the energies to the shared memory
-            cupla::atomicAdd(acc, &shEnergyKin, localEnergyKin, ::alpaka::hierarchy::Threads{});
-            cupla::atomicAdd(acc, &shEnergy, localEnergy, ::alpaka::hierarchy::Threads{});
-
-            // wait that all virtual threads updated the shared memory energies
-            cupla::__syncthreads(acc);
-
-            // add energies on global level using global memory
-            masterOnly([&]() {
-                // add kinetic energy
-                cupla::atomicAdd(
-                    acc,
-                    &(gEnergy[0]),
-                    static_cast<float_64>(shEnergyKin),
-                    ::alpaka::hierarchy::Blocks{});
-                // add total energy
-                cupla::atomicAdd(acc, &(gEnergy[1]), static_cast<float_64>(shEnergy), ::alpaka::hierarchy::Blocks{});
-            });
-        }
-    };
-
     template<typename ParticlesType>
     class EnergyParticles : public plugins::multi::IInstance
     {
@@ -208,9 +64,7 @@ namespace picongpu
             }
 
             // find all valid filter for the current used species
-            using EligibleFilters = typename MakeSeqFromNestedSeq<typename bmpl::transform<
-                particles::filter::AllParticleFilters,
-                particles::traits::GenerateSolversIfSpeciesEligible<bmpl::_1, ParticlesType>>::type>::type;
+            using EligibleFilters = typename plugins::misc::SpeciesSweep<ParticlesType>::EligibleFilters;
 
             //! periodicity of computing the particle energy
             plugins::multi::Option<std::string> notifyPeriod
@@ -296,14 +150,12 @@ namespace picongpu
             : m_help(std::static_pointer_cast<Help>(help))
             , m_id(id)
             , m_cellDescription(cellDescription)
+            , sweep(plugins::misc::SpeciesSweep<ParticlesType>::get())
         {
             filename = m_help->getOptionPrefix() + "_" + m_help->filter.get(m_id) + ".dat";
 
             // decide which MPI-rank writes output
-            writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
-
-            // create two ints on gpu and host
-            gEnergy = std::make_unique<GridBuffer<float_64, DIM1>>(DataSpace<DIM1>(2));
+            writeToFile = sweep->hasResult();
 
             // only MPI rank that writes to file
             if(writeToFile)
@@ -348,7 +200,7 @@ namespace picongpu
         void notify(uint32_t currentStep) override
         {
             // call the method that calls the plugin kernel
-            calculateEnergyParticles<CORE + BORDER>(currentStep);
+            calculateEnergyParticles(currentStep);
         }
 
 
@@ -369,49 +221,13 @@ namespace picongpu
         }
 
     private:
-        //! method to call analysis and plugin-kernel calls
-        template<uint32_t AREA>
+        /** method to get the energies from the species sweep
+         *
+         * The sweep is shared with other plugins requesting the same filter on this step.
+         */
         void calculateEnergyParticles(uint32_t currentStep)
         {
-            DataConnector& dc = Environment<>::get().DataConnector();
-
-            // use data connector to get particle data
-            auto particles = dc.get<ParticlesType>(ParticlesType::FrameType::getName(), true);
-
-            // initialize global energies with zero
-            gEnergy->getDeviceBuffer().setValue(0.0);
-
-            constexpr uint32_t numWorkers
-                = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
-
-            auto const mapper = makeAreaMapper<AREA>(*m_cellDescription);
-
-            auto kernel = PMACC_KERNEL(KernelEnergyParticles<numWorkers>{})(mapper.getGridDim(), numWorkers);
-            auto binaryKernel = std::bind(
-                kernel,
-                particles->getDeviceParticlesBox(),
-                gEnergy->getDeviceBuffer().getDataBox(),
-                mapper,
-                std::placeholders::_1);
-
-            meta::ForEach<typename Help::EligibleFilters, plugins::misc::ExecuteIfNameIsEqual<bmpl::_1>>{}(
-                m_help->filter.get(m_id),
-                currentStep,
-                binaryKernel);
-
-            // get energy from GPU
-            gEnergy->deviceToHost();
-
-            // create storage for the global reduced result
-            float_64 reducedEnergy[2];
-
-            // add energies from all GPUs using MPI
-            reduce(
-                pmacc::math::operation::Add(),
-                reducedEnergy,
-                gEnergy->getHostBuffer().getBasePointer(),
-                2,
-                mpi::reduceMethods::Reduce());
+            auto const& sums = sweep->getSums(currentStep, m_help->filter.get(m_id), *m_cellDescription);
 
             /* print timestep, kinetic energy and total energy to file: */
             if(writeToFile)
@@ -419,16 +235,16 @@ namespace picongpu
                 using dbl = std::numeric_limits<float_64>;
 
                 outFile.precision(dbl::digits10);
-                outFile << currentStep << " " << std::scientific << reducedEnergy[0] * UNIT_ENERGY << " "
-                        << reducedEnergy[1] * UNIT_ENERGY << std::endl;
+                outFile << currentStep << " " << std::scientific << sums.energyKin * UNIT_ENERGY << " "
+                        << sums.energy * UNIT_ENERGY << std::endl;
             }
         }
 
-        //! energy values (global on GPU)
-        std::unique_ptr<GridBuffer<float_64, DIM1>> gEnergy;
-
         MappingDesc* m_cellDescription;
 
+        //! particle sweep providing the energies
+        std::shared_ptr<plugins::misc::SpeciesSweep<ParticlesType>> sweep;
+
         //! output file name
         std::string filename;
 
@@ -441,9 +257,6 @@ namespace picongpu
          */
         bool writeToFile = false;
 
-        //! MPI reduce to add all energies over several GPUs
-        mpi::MPIReduce reduce;
-
         std::shared_ptr<Help> m_help;
         size_t m_id;
     };
@@ -223,6 +223,22 @@ namespace picongpu
 
         std::unique_ptr<container::DeviceBuffer<float_PS, 2>> dBuffer;
 
+        //! local phase space, source of the plane reduce
+        std::unique_ptr<container::HostBuffer<float_PS, 2>> hBuffer;
+        //! plane reduced phase space, only valid on the plane reduce root
+        std::unique_ptr<container::HostBuffer<float_PS, 2>> hReducedBuffer;
+
+        /** request of the pending plane reduce
+         *
+         * The reduce is started in notify() and completed and written at the next notify(), before a checkpoint or
+         * at the end of the simulation.
+         */
+        MPI_Request reduceRequest = MPI_REQUEST_NULL;
+        //! true if a reduce was started but is not completed
+        bool isReducePending = false;
+        //! time step of the pending reduce
+        uint32_t reduceStep = 0u;
+
         /** reduce functor to a single host per plane */
         std::unique_ptr<pmacc::algorithm::mpi::Reduce<simDim>> planeReduce;
         bool isPlaneReduceRoot = false;
@@ -287,8 +303,23 @@ namespace picongpu
         {
         }
 
+        //! write the phase space of a reduce which is still pending
+        void pluginUnload() override
+        {
+            finishReduce();
+        }
+
         template<uint32_t Direction>
         void calcPhaseSpace(const uint32_t currentStep);
+
+        /** Wait for the pending plane reduce and write the phase space
+         *
+         * The reduce started in notify() is completed by the next notify() or, at the end of the
+         * simulation, by pluginUnload(). Both are called by all MPI ranks while MPI is initialized.
+         * The output of a step does not depend on a checkpoint, hence a checkpoint leaves the
+         * reduce pending.
+         */
+        void finishReduce();
     };
 
     namespace particles
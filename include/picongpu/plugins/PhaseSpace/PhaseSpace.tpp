@@ -100,6 +100,8 @@ namespace picongpu
 
             auto const num_pbinsToAvoidOdrUse = this->num_pbins;
             this->dBuffer = std::make_unique<container::DeviceBuffer<float_PS, 2>>(num_pbinsToAvoidOdrUse, r_bins);
+            this->hBuffer = std::make_unique<container::HostBuffer<float_PS, 2>>(this->dBuffer->size());
+            this->hReducedBuffer = std::make_unique<container::HostBuffer<float_PS, 2>>(this->dBuffer->size());
 
             /* reduce-add phase space from other GPUs in range [p0;p1]x[r;r+dr]
              * to "lowest" node in range
@@ -239,6 +241,8 @@ namespace picongpu
     template<class AssignmentFunction, class Species>
     void PhaseSpace<AssignmentFunction, Species>::notify(uint32_t currentStep)
     {
+        finishReduce();
+
         /* reset device buffer */
         this->dBuffer->assign(float_PS(0.0));
 
@@ -253,23 +257,38 @@ namespace picongpu
 #endif
 
         /* transfer to host */
-        container::HostBuffer<float_PS, 2> hBuffer(this->dBuffer->size());
-        hBuffer = *this->dBuffer;
+        *this->hBuffer = *this->dBuffer;
 
         /* reduce-add phase space from other GPUs in range [p0;p1]x[r;r+dr]
          * to "lowest" node in range
          * e.g.: phase space x-py: reduce-add all nodes with same x range in
          *                         spatial y and z direction to node with
          *                         lowest y and z position and same x range
+         *
+         * The reduce is completed and written in finishReduce() which is called the next time the plugin is
+         * executed or when it is unloaded, thus the reduce is overlapped with the simulation.
          */
-        container::HostBuffer<float_PS, 2> hReducedBuffer(hBuffer.size());
-        hReducedBuffer.assign(float_PS(0.0));
+        this->hReducedBuffer->assign(float_PS(0.0));
+
+        // avoid reducing data which is not yet copied from the device
+        __getTransactionEvent().waitForFinished();
+        reduceRequest = planeReduce->startReduce(/* parameters: dest, source */
+                                                 *this->hReducedBuffer,
+                                                 *this->hBuffer,
+                                                 /* the functors return value will be written to dst */
+                                                 pmacc::algorithm::functor::Add());
+        reduceStep = currentStep;
+        isReducePending = true;
+    }
+
+    template<class AssignmentFunction, class Species>
+    void PhaseSpace<AssignmentFunction, Species>::finishReduce()
+    {
+        if(!isReducePending)
+            return;
+        isReducePending = false;
 
-        planeReduce->template operator()(/* parameters: dest, source */
-                                         hReducedBuffer,
-                                         hBuffer,
-                                         /* the functors return value will be written to dst */
-                                         pmacc::algorithm::functor::Add());
+        MPI_CHECK(MPI_Wait(&reduceRequest, MPI_STATUS_IGNORE));
 
         /** all non-reduce-root processes are done now */
         if(!this->isPlaneReduceRoot)
@@ -293,7 +312,7 @@ namespace picongpu
 
         if(this->commFileWriter != MPI_COMM_NULL)
             dumpHBuffer(
-                hReducedBuffer,
+                *this->hReducedBuffer,
                 this->axis_element,
                 this->axis_p_range,
                 pRange_unit,
@@ -301,7 +320,7 @@ namespace picongpu
                 Species::FrameType::getName() + "_" + m_help->filter.get(m_id),
                 m_help->file_name_extension.get(m_id),
                 m_help->json_config.get(m_id),
-                currentStep,
+                reduceStep,
                 this->commFileWriter);
     }
 
@@ -30,9 +30,11 @@
 #include "picongpu/plugins/EnergyFields.hpp"
 #include "picongpu/plugins/EnergyParticles.hpp"
 #include "picongpu/plugins/SumCurrents.hpp"
+#include "picongpu/plugins/loadBalance/LoadBalance.hpp"
 #include "picongpu/plugins/multi/Master.hpp"
 #include "picongpu/plugins/output/images/PngCreator.hpp"
 #include "picongpu/plugins/output/images/Visualisation.hpp"
+#include "picongpu/plugins/profiling/Profiling.hpp"
 #include "picongpu/plugins/transitionRadiation/TransitionRadiation.hpp"
 
 #include <pmacc/assert.hpp>
@@ -170,7 +172,9 @@ namespace picongpu
             isaacP::IsaacPlugin
 #endif
             ,
-            ResourceLog>;
+            ResourceLog,
+            plugins::loadBalance::LoadBalance,
+            plugins::profiling::Profiling>;
 
 
         /* define field plugins */
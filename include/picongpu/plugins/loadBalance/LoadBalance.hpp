@@ -0,0 +1,348 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/fields/absorber/Absorber.hpp"
+#include "picongpu/plugins/ILightweightPlugin.hpp"
+#include "picongpu/plugins/common/txtFileHandling.hpp"
+#include "picongpu/plugins/loadBalance/LoadBalance.kernel"
+#include "picongpu/plugins/loadBalance/SlabPartition.hpp"
+#include "picongpu/simulation/control/MovingWindow.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/math/operation.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/meta/ForEach.hpp>
+#include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/mpi/reduceMethods/Reduce.hpp>
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace loadBalance
+        {
+            using namespace pmacc;
+
+            /** add the number of macro particles per supercell of a species to a counter
+             *
+             * @tparam T_Species particle species type
+             */
+            template<typename T_Species>
+            struct AddParticlesPerSuperCell
+            {
+                template<typename T_CounterBuffer>
+                void operator()(T_CounterBuffer& counter, MappingDesc const& cellDescription) const
+                {
+                    DataConnector& dc = Environment<>::get().DataConnector();
+                    auto particles = dc.get<T_Species>(T_Species::FrameType::getName(), true);
+
+                    auto const mapper = makeAreaMapper<CORE + BORDER>(cellDescription);
+                    PMACC_KERNEL(KernelAddParticlesPerSuperCell{})
+                    (mapper.getGridDim(), 1)(
+                        particles->getDeviceParticlesBox(),
+                        counter.getDeviceBuffer().getDataBox(),
+                        mapper);
+                }
+            };
+
+            /** measure the load of each rank and propose a balanced domain decomposition
+             *
+             * The cost of a supercell is modeled as the number of macro particles of all species plus
+             * a weighted number of cells (field solver). The cost is projected to each axis and for each axis a
+             * distribution of supercell slabs is derived that minimizes the maximal cost of a rank.
+             * The proposal is written in the format of the command line option `--gridDist` and can be applied
+             * by restarting the simulation from a checkpoint.
+             *
+             * Output: only the master rank writes the file `loadBalance.dat`
+             */
+            class LoadBalance : public ILightweightPlugin
+            {
+            private:
+                using SuperCellSize = MappingDesc::SuperCellSize;
+                using CounterBuffer = GridBuffer<uint64_cu, simDim>;
+
+                MappingDesc* cellDescription = nullptr;
+                std::string notifyPeriod;
+                float_64 cellWeight;
+
+                std::string const filename = "loadBalance.dat";
+                std::ofstream outFile;
+                //! only the master rank writes the output file
+                bool writeToFile = false;
+
+                std::unique_ptr<CounterBuffer> particlesPerSuperCell;
+                //! number of supercell slabs per rank along each axis of the current decomposition
+                std::array<std::vector<uint32_t>, simDim> currentSlabsPerRank;
+                //! minimal number of supercell slabs per rank along each axis
+                std::array<std::vector<uint32_t>, simDim> minSlabsPerRank;
+
+                mpi::MPIReduce reduce;
+
+            public:
+                LoadBalance()
+                {
+                    Environment<>::get().PluginConnector().registerPlugin(this);
+                }
+
+                std::string pluginGetName() const override
+                {
+                    return "LoadBalance";
+                }
+
+                void pluginRegisterHelp(po::options_description& desc) override
+                {
+                    desc.add_options()(
+                        "loadBalance.period",
+                        po::value<std::string>(&notifyPeriod),
+                        "measure the load imbalance and propose a balanced --gridDist [for each n-th step]")(
+                        "loadBalance.cellWeight",
+                        po::value<float_64>(&cellWeight)->default_value(0.5),
+                        "cost of a cell (field solver) relative to the cost of one macro particle");
+                }
+
+                void setMappingDescription(MappingDesc* cellDescription) override
+                {
+                    this->cellDescription = cellDescription;
+                }
+
+                void notify(uint32_t currentStep) override
+                {
+                    SubGrid<simDim> const& subGrid = Environment<simDim>::get().SubGrid();
+                    DataSpace<simDim> const superCellSize = SuperCellSize::toRT();
+                    DataSpace<simDim> const localSuperCells = subGrid.getLocalDomain().size / superCellSize;
+                    DataSpace<simDim> const localSlabOffset = subGrid.getLocalDomain().offset / superCellSize;
+                    DataSpace<simDim> const globalSuperCells = subGrid.getGlobalDomain().size / superCellSize;
+
+                    particlesPerSuperCell->getDeviceBuffer().setValue(0u);
+                    meta::ForEach<VectorAllSpecies, AddParticlesPerSuperCell<bmpl::_1>> addParticles;
+                    addParticles(*particlesPerSuperCell, *cellDescription);
+                    particlesPerSuperCell->deviceToHost();
+
+                    /* cost profile along each axis in global supercell slabs,
+                     * all axes are stored back to back to reduce them with a single MPI call
+                     */
+                    std::array<size_t, simDim + 1u> axisBegin;
+                    axisBegin[0] = 0u;
+                    for(uint32_t d = 0u; d < simDim; ++d)
+                        axisBegin[d + 1u] = axisBegin[d] + globalSuperCells[d];
+
+                    // last element is the total cost of this rank
+                    std::vector<float_64> localCost(axisBegin[simDim] + 1u, 0.0);
+                    float_64 const superCellCost
+                        = cellWeight * static_cast<float_64>(superCellSize.productOfComponents());
+                    auto counterBox = particlesPerSuperCell->getHostBuffer().getDataBox();
+                    for(int i = 0; i < localSuperCells.productOfComponents(); ++i)
+                    {
+                        DataSpace<simDim> const superCellIdx = DataSpaceOperations<simDim>::map(localSuperCells, i);
+                        float_64 const cost = static_cast<float_64>(counterBox(superCellIdx)) + superCellCost;
+                        for(uint32_t d = 0u; d < simDim; ++d)
+                            localCost[axisBegin[d] + localSlabOffset[d] + superCellIdx[d]] += cost;
+                        localCost.back() += cost;
+                    }
+
+                    std::vector<float_64> globalCost(localCost.size());
+                    reduce(
+                        pmacc::math::operation::Add(),
+                        globalCost.data(),
+                        localCost.data(),
+                        localCost.size(),
+                        mpi::reduceMethods::Reduce());
+
+                    float_64 maxRankCost;
+                    reduce(
+                        pmacc::math::operation::Max(),
+                        &maxRankCost,
+                        &localCost.back(),
+                        1u,
+                        mpi::reduceMethods::Reduce());
+
+                    if(!writeToFile)
+                        return;
+
+                    auto const numRanks = Environment<simDim>::get().GridController().getGpuNodes();
+                    float_64 const meanRankCost = globalCost.back() / static_cast<float_64>(numRanks.productOfComponents());
+                    float_64 const currentImbalance = meanRankCost > 0.0 ? maxRankCost / meanRankCost : 1.0;
+
+                    outFile << currentStep << " " << currentImbalance;
+                    for(uint32_t d = 0u; d < simDim; ++d)
+                    {
+                        std::vector<double> const axisCost(
+                            globalCost.begin() + axisBegin[d],
+                            globalCost.begin() + axisBegin[d + 1u]);
+
+                        std::vector<uint32_t> slabsPerRank = currentSlabsPerRank[d];
+                        if(!isSlidingAxis(d))
+                        {
+                            auto const balancedSlabsPerRank = balanceSlabs(axisCost, minSlabsPerRank[d]);
+                            if(!balancedSlabsPerRank.empty())
+                                slabsPerRank = balancedSlabsPerRank;
+                        }
+
+                        std::vector<uint32_t> cellsPerRank(slabsPerRank.size());
+                        std::transform(
+                            slabsPerRank.begin(),
+                            slabsPerRank.end(),
+                            cellsPerRank.begin(),
+                            [&](uint32_t const numSlabs) { return numSlabs * superCellSize[d]; });
+
+                        outFile << " " << imbalance(axisCost, currentSlabsPerRank[d]) << " "
+                                << imbalance(axisCost, slabsPerRank) << " \"" << toGridDistribution(cellsPerRank)
+                                << "\"";
+                    }
+                    outFile << std::endl;
+                    if(outFile.fail())
+                    {
+                        std::cerr << "Error on writing file [" << filename << "], disable plugin output. " << std::endl;
+                        writeToFile = false;
+                    }
+                }
+
+            private:
+                void pluginLoad() override
+                {
+                    if(notifyPeriod.empty())
+                        return;
+
+                    Environment<>::get().PluginConnector().setNotificationPeriod(this, notifyPeriod);
+
+                    SubGrid<simDim> const& subGrid = Environment<simDim>::get().SubGrid();
+                    DataSpace<simDim> const superCellSize = SuperCellSize::toRT();
+                    DataSpace<simDim> const localSuperCells = subGrid.getLocalDomain().size / superCellSize;
+                    particlesPerSuperCell = std::make_unique<CounterBuffer>(localSuperCells);
+
+                    GridController<simDim>& gc = Environment<simDim>::get().GridController();
+                    DataSpace<simDim> const numRanks = gc.getGpuNodes();
+                    DataSpace<simDim> const rankPosition = gc.getPosition();
+
+                    auto const& absorber = fields::absorber::Absorber::get();
+                    auto const absorberThickness = absorber.getGlobalThickness();
+                    std::array<char, 3> const axisNames = {{'x', 'y', 'z'}};
+
+                    writeToFile = reduce.hasResult(mpi::reduceMethods::Reduce());
+                    if(writeToFile)
+                    {
+                        outFile.open(filename.c_str(), std::ofstream::out | std::ostream::trunc);
+                        if(!outFile)
+                        {
+                            std::cerr << "Can't open file [" << filename << "] for output, disable plugin output. "
+                                      << std::endl;
+                            writeToFile = false;
+                        }
+                        else
+                        {
+                            outFile << "#step imbalance";
+                            for(uint32_t d = 0u; d < simDim; ++d)
+                                outFile << " imbalance_" << axisNames[d] << " proposedImbalance_" << axisNames[d]
+                                        << " gridDist_" << axisNames[d];
+                            outFile << std::endl;
+                        }
+                    }
+
+                    for(uint32_t d = 0u; d < simDim; ++d)
+                    {
+                        // share the local number of slabs of all ranks along the axis
+                        std::vector<uint32_t> localSlabs(numRanks[d], 0u);
+                        localSlabs[rankPosition[d]] = static_cast<uint32_t>(localSuperCells[d]);
+                        currentSlabsPerRank[d].resize(numRanks[d]);
+                        reduce(
+                            pmacc::math::operation::Max(),
+                            currentSlabsPerRank[d].data(),
+                            localSlabs.data(),
+                            localSlabs.size(),
+                            mpi::reduceMethods::Reduce());
+
+                        /* the constraints are equal to those validated by the DomainAdjuster:
+                         * at least three supercells and the absorber must fit into the boundary ranks
+                         */
+                        minSlabsPerRank[d].assign(numRanks[d], 3u);
+                        if(!isPeriodic(d))
+                        {
+                            uint32_t const lowerAbsorberSlabs
+                                = (absorberThickness(d, 0) + superCellSize[d] - 1u) / superCellSize[d];
+                            uint32_t const upperAbsorberSlabs
+                                = (absorberThickness(d, 1) + superCellSize[d] - 1u) / superCellSize[d];
+                            if(numRanks[d] == 1)
+                                minSlabsPerRank[d].front()
+                                    = std::max(minSlabsPerRank[d].front(), lowerAbsorberSlabs + upperAbsorberSlabs);
+                            else
+                            {
+                                minSlabsPerRank[d].front() = std::max(minSlabsPerRank[d].front(), lowerAbsorberSlabs);
+                                minSlabsPerRank[d].back() = std::max(minSlabsPerRank[d].back(), upperAbsorberSlabs);
+                            }
+                        }
+                    }
+                }
+
+                void pluginUnload() override
+                {
+                    if(writeToFile)
+                    {
+                        outFile.flush();
+                        if(outFile.fail())
+                            std::cerr << "Error on flushing file [" << filename << "]. " << std::endl;
+                        outFile.close();
+                    }
+                    particlesPerSuperCell.reset();
+                }
+
+                void restart(uint32_t restartStep, std::string const restartDirectory) override
+                {
+                    if(!writeToFile)
+                        return;
+
+                    writeToFile = restoreTxtFile(outFile, filename, restartStep, restartDirectory);
+                }
+
+                void checkpoint(uint32_t currentStep, std::string const checkpointDirectory) override
+                {
+                    if(!writeToFile)
+                        return;
+
+                    checkpointTxtFile(outFile, filename, currentStep, checkpointDirectory);
+                }
+
+                //! the moving window requires equally sized domains along y
+                static bool isSlidingAxis(uint32_t const axis)
+                {
+                    return axis == 1u && MovingWindow::getInstance().isEnabled();
+                }
+
+                static bool isPeriodic(uint32_t const axis)
+                {
+                    return Environment<simDim>::get().GridController().getCommunicator().getPeriodic()[axis] != 0;
+                }
+            };
+
+        } // namespace loadBalance
+    } // namespace plugins
+} // namespace picongpu
@@ -0,0 +1,163 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "picongpu/plugins/loadBalance/SlabPartition.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace loadBalance
+        {
+            namespace
+            {
+                /** greedy partitioning with an upper cost limit per part
+                 *
+                 * Each part takes as many slabs as possible without exceeding maxCost and
+                 * leaves enough slabs for the minimal sizes of all following parts.
+                 *
+                 * @param prefixCost prefixCost[i] is the cost of the first i slabs
+                 * @param minSlabsPerPart minimal number of slabs for each part
+                 * @param maxCost upper cost limit per part
+                 * @param[out] slabsPerPart number of slabs per part, only valid if true is returned
+                 * @return true if the slabs can be distributed without exceeding maxCost
+                 */
+                bool partition(
+                    std::vector<double> const& prefixCost,
+                    std::vector<uint32_t> const& minSlabsPerPart,
+                    double const maxCost,
+                    std::vector<uint32_t>& slabsPerPart)
+                {
+                    size_t const numSlabs = prefixCost.size() - 1u;
+                    size_t const numParts = minSlabsPerPart.size();
+
+                    size_t remainingMinSlabs
+                        = std::accumulate(minSlabsPerPart.begin(), minSlabsPerPart.end(), size_t(0u));
+
+                    slabsPerPart.resize(numParts);
+                    size_t begin = 0u;
+                    for(size_t p = 0u; p < numParts; ++p)
+                    {
+                        remainingMinSlabs -= minSlabsPerPart[p];
+                        size_t const minEnd = begin + minSlabsPerPart[p];
+                        size_t const maxEnd = numSlabs - remainingMinSlabs;
+                        size_t end = maxEnd;
+
+                        if(p + 1u != numParts)
+                        {
+                            // first slab end which would exceed the cost limit
+                            auto const limit = std::upper_bound(
+                                prefixCost.begin() + minEnd,
+                                prefixCost.begin() + maxEnd + 1u,
+                                prefixCost[begin] + maxCost);
+                            auto const limitEnd = static_cast<size_t>(limit - prefixCost.begin());
+                            end = limitEnd > minEnd ? limitEnd - 1u : minEnd;
+                        }
+
+                        if(prefixCost[end] - prefixCost[begin] > maxCost)
+                            return false;
+
+                        slabsPerPart[p] = static_cast<uint32_t>(end - begin);
+                        begin = end;
+                    }
+                    return true;
+                }
+            } // namespace
+
+            std::vector<uint32_t> balanceSlabs(
+                std::vector<double> const& costPerSlab,
+                std::vector<uint32_t> const& minSlabsPerPart)
+            {
+                size_t const numMinSlabs
+                    = std::accumulate(minSlabsPerPart.begin(), minSlabsPerPart.end(), size_t(0u));
+                if(minSlabsPerPart.empty() || numMinSlabs > costPerSlab.size())
+                    return {};
+
+                std::vector<double> prefixCost(costPerSlab.size() + 1u, 0.0);
+                std::partial_sum(costPerSlab.begin(), costPerSlab.end(), prefixCost.begin() + 1u);
+
+                std::vector<uint32_t> slabsPerPart;
+                // the maximum cost per part is bisected, the total cost is always a valid limit
+                double lowerLimit = 0.0;
+                double upperLimit = prefixCost.back();
+                constexpr int numBisections = 64;
+                for(int i = 0; i < numBisections; ++i)
+                {
+                    double const limit = 0.5 * (lowerLimit + upperLimit);
+                    if(partition(prefixCost, minSlabsPerPart, limit, slabsPerPart))
+                        upperLimit = limit;
+                    else
+                        lowerLimit = limit;
+                }
+                partition(prefixCost, minSlabsPerPart, upperLimit, slabsPerPart);
+                return slabsPerPart;
+            }
+
+            double imbalance(std::vector<double> const& costPerSlab, std::vector<uint32_t> const& slabsPerPart)
+            {
+                if(slabsPerPart.empty())
+                    return 1.0;
+
+                double maxCost = 0.0;
+                double totalCost = 0.0;
+                size_t begin = 0u;
+                for(auto const numSlabs : slabsPerPart)
+                {
+                    double const cost = std::accumulate(
+                        costPerSlab.begin() + begin,
+                        costPerSlab.begin() + begin + numSlabs,
+                        0.0);
+                    maxCost = std::max(maxCost, cost);
+                    totalCost += cost;
+                    begin += numSlabs;
+                }
+                double const meanCost = totalCost / static_cast<double>(slabsPerPart.size());
+                return meanCost > 0.0 ? maxCost / meanCost : 1.0;
+            }
+
+            std::string toGridDistribution(std::vector<uint32_t> const& cellsPerPart)
+            {
+                std::stringstream gridDist;
+                for(size_t i = 0u; i < cellsPerPart.size();)
+                {
+                    // collapse equal neighboring extents to the form `extent{count}`
+                    size_t count = 1u;
+                    while(i + count < cellsPerPart.size() && cellsPerPart[i + count] == cellsPerPart[i])
+                        ++count;
+
+                    if(i != 0u)
+                        gridDist << ",";
+                    gridDist << cellsPerPart[i];
+                    if(count > 1u)
+                        gridDist << "{" << count << "}";
+                    i += count;
+                }
+                return gridDist.str();
+            }
+        } // namespace loadBalance
+    } // namespace plugins
+} // namespace picongpu
@@ -0,0 +1,65 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace loadBalance
+        {
+            /** split a 1D cost profile into contiguous parts with a minimal maximum cost
+             *
+             * Each entry of the profile is the cost of one supercell slab.
+             * The result is the number of slabs assigned to each part (in order).
+             * Each part is assigned at least minSlabsPerPart[i] slabs.
+             *
+             * @param costPerSlab cost of each slab, all values must be >= 0
+             * @param minSlabsPerPart minimal number of slabs for each part, the number of parts is the size of
+             *                        this vector
+             * @return number of slabs per part, empty if the slabs can not be distributed
+             */
+            std::vector<uint32_t> balanceSlabs(
+                std::vector<double> const& costPerSlab,
+                std::vector<uint32_t> const& minSlabsPerPart);
+
+            /** maximum cost of a part divided by the mean cost of all parts
+             *
+             * @param costPerSlab cost of each slab
+             * @param slabsPerPart number of slabs per part
+             * @return imbalance factor, 1.0 is a perfect balance
+             */
+            double imbalance(std::vector<double> const& costPerSlab, std::vector<uint32_t> const& slabsPerPart);
+
+            /** create a compact grid distribution string
+             *
+             * The result is accepted by the command line option `--gridDist` e.g. `64,32{2},64`.
+             *
+             * @param cellsPerPart number of cells per part
+             */
+            std::string toGridDistribution(std::vector<uint32_t> const& cellsPerPart);
+        } // namespace loadBalance
+    } // namespace plugins
+} // namespace picongpu
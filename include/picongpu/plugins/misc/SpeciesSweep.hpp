@@ -0,0 +1,459 @@
+/* Copyright 2013-2021 Axel Huebl, Felix Schmitt, Heiko Burau, Rene Widera,
+ *                     Richard Pausch, Benjamin Worpitz, Sergei Bastrakov
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/algorithms/KinEnergy.hpp"
+#include "picongpu/particles/filter/filter.hpp"
+#include "picongpu/particles/traits/GenerateSolversIfSpeciesEligible.hpp"
+#include "picongpu/plugins/misc/ExecuteIfNameIsEqual.hpp"
+
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/lockstep.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/math/operation.hpp>
+#include <pmacc/memory/shared/Allocate.hpp>
+#include <pmacc/meta/ForEach.hpp>
+#include <pmacc/mpi/MPIReduce.hpp>
+#include <pmacc/mpi/reduceMethods/Reduce.hpp>
+#include <pmacc/pluginSystem/PluginConnector.hpp>
+#include <pmacc/traits/GetNumWorkers.hpp>
+#include <pmacc/traits/HasFlag.hpp>
+#include <pmacc/traits/HasIdentifiers.hpp>
+
+#include <boost/mpl/and.hpp>
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace misc
+        {
+            /** Sums over all particles of a species passing a filter
+             *
+             * Values are in PIC units.
+             */
+            struct ParticleSums
+            {
+                //! number of macro particles
+                uint64_cu numMacroParticles = 0u;
+                //! kinetic energy, zero if the species has no momentum or mass
+                float_64 energyKin = 0.0;
+                //! total energy, zero if the species has no momentum or mass
+                float_64 energy = 0.0;
+
+                //! number of energy sums, the order of the members is the order in the energy buffer
+                static constexpr uint32_t numEnergies = 2u;
+            };
+
+            namespace detail
+            {
+                /** Get the generation of the sums cached by all SpeciesSweep instances
+                 *
+                 * Any notified object, e.g. the particle merger, may change particles. Cached sums are therefore
+                 * only reused while all objects notified since they were computed requested sums, too. The
+                 * generation is increased if the last request was not during the current or the previous
+                 * notification.
+                 *
+                 * @param notification number of the current notification, see
+                 *                     PluginConnector::getNumNotifications()
+                 */
+                inline uint64_t getCacheGeneration(uint64_t const notification)
+                {
+                    static uint64_t generation = 0u;
+                    static uint64_t lastNotification = 0u;
+                    if(notification != lastNotification && notification != lastNotification + 1u)
+                        ++generation;
+                    lastNotification = notification;
+                    return generation;
+                }
+            } // namespace detail
+
+            /** accumulate the number of macro particles and the kinetic and total energy
+             *
+             * @tparam T_numWorkers number of workers
+             * @tparam T_computeEnergy whether the energies are accumulated, requires momentum, weighting and mass
+             */
+            template<uint32_t T_numWorkers, bool T_computeEnergy>
+            struct KernelParticleSums
+            {
+                /** accumulate particle sums
+                 *
+                 * @tparam T_ParBox pmacc::ParticlesBox, particle box type
+                 * @tparam T_CountBox pmacc::DataBox, type of the memory box for the number of particles
+                 * @tparam T_EnergyBox pmacc::DataBox, type of the memory box for the energies
+                 * @tparam T_Mapping mapper functor type
+                 *
+                 * @param pb particle memory
+                 * @param gCount storage for the number of macro particles
+                 * @param gEnergies storage for the energies, in the order of the members of ParticleSums
+                 * @param mapper functor to map a block to a supercell
+                 */
+                template<
+                    typename T_ParBox,
+                    typename T_CountBox,
+                    typename T_EnergyBox,
+                    typename T_Mapping,
+                    typename T_Acc,
+                    typename T_Filter>
+                DINLINE void operator()(
+                    T_Acc const& acc,
+                    T_ParBox pb,
+                    T_CountBox gCount,
+                    T_EnergyBox gEnergies,
+                    T_Mapping mapper,
+                    T_Filter filter) const
+                {
+                    constexpr uint32_t numWorkers = T_numWorkers;
+                    constexpr uint32_t numParticlesPerFrame
+                        = pmacc::math::CT::volume<typename T_ParBox::FrameType::SuperCellSize>::type::value;
+
+                    uint32_t const workerIdx = cupla::threadIdx(acc).x;
+
+                    using FramePtr = typename T_ParBox::FramePtr;
+
+                    // shared number of macro particles
+                    PMACC_SMEM(acc, shNumMacroParticles, uint32_t);
+                    // shared kinetic energy
+                    PMACC_SMEM(acc, shEnergyKin, float_X);
+                    // shared total energy
+                    PMACC_SMEM(acc, shEnergy, float_X);
+
+                    // sums for all particles touched by the virtual thread
+                    uint32_t localNumMacroParticles = 0u;
+                    float_X localEnergyKin(0.0);
+                    float_X localEnergy(0.0);
+
+                    auto masterOnly = lockstep::makeMaster(workerIdx);
+
+                    masterOnly([&]() {
+                        shNumMacroParticles = 0u;
+                        shEnergyKin = float_X(0.0);
+                        shEnergy = float_X(0.0);
+                    });
+
+                    cupla::__syncthreads(acc);
+
+                    DataSpace<simDim> const superCellIdx(
+                        mapper.getSuperCellIndex(DataSpace<simDim>(cupla::blockIdx(acc))));
+
+                    // each virtual thread is working on an own frame
+                    FramePtr frame = pb.getLastFrame(superCellIdx);
+
+                    // end kernel if we have no frames within the supercell
+                    if(!frame.isValid())
+                        return;
+
+                    auto accFilter = filter(
+                        acc,
+                        superCellIdx - mapper.getGuardingSuperCells(),
+                        lockstep::Worker<numWorkers>{workerIdx});
+
+                    auto forEachParticleInFrame = lockstep::makeForEach<numParticlesPerFrame, numWorkers>(workerIdx);
+
+                    auto currentParticleCtx = forEachParticleInFrame(
+
+                        [&](uint32_t const linearIdx) -> typename FramePtr::type::ParticleType {
+                            auto particle = frame[linearIdx];
+                            /* - only particles from the last frame must be checked
+                             * - all other particles are always valid
+                             */
+                            if(particle[multiMask_] != 1)
+                                particle.setHandleInvalid();
+                            return particle;
+                        });
+
+                    while(frame.isValid())
+                    {
+                        // loop over all particles in the frame
+                        forEachParticleInFrame([&](lockstep::Idx const idx) {
+                            /* get one particle */
+                            auto& particle = currentParticleCtx[idx];
+                            if(accFilter(acc, particle))
+                            {
+                                ++localNumMacroParticles;
+                                addEnergies(
+                                    particle,
+                                    localEnergyKin,
+                                    localEnergy,
+                                    std::integral_constant<bool, T_computeEnergy>{});
+                            }
+                        });
+
+                        // set frame to next particle frame
+                        frame = pb.getPreviousFrame(frame);
+                        forEachParticleInFrame([&](lockstep::Idx const idx) {
+                            /* Update particle for the next round.
+                             * The frame list is traverse from the last to the first frame.
+                             * Only the last frame can contain gaps therefore all following
+                             * frames are filled with fully particles.
+                             */
+                            currentParticleCtx[idx] = frame[idx];
+                        });
+                    }
+
+                    // each virtual thread adds its sums to the shared memory
+                    cupla::atomicAdd(
+                        acc,
+                        &shNumMacroParticles,
+                        localNumMacroParticles,
+                        ::alpaka::hierarchy::Threads{});
+                    if(T_computeEnergy)
+                    {
+                        cupla::atomicAdd(acc, &shEnergyKin, localEnergyKin, ::alpaka::hierarchy::Threads{});
+                        cupla::atomicAdd(acc, &shEnergy, localEnergy, ::alpaka::hierarchy::Threads{});
+                    }
+
+                    // wait that all virtual threads updated the shared memory sums
+                    cupla::__syncthreads(acc);
+
+                    // add sums on global level using global memory
+                    masterOnly([&]() {
+                        cupla::atomicAdd(
+                            acc,
+                            &(gCount[0]),
+                            static_cast<uint64_cu>(shNumMacroParticles),
+                            ::alpaka::hierarchy::Blocks{});
+                        if(T_computeEnergy)
+                        {
+                            cupla::atomicAdd(
+                                acc,
+                                &(gEnergies[0]),
+                                static_cast<float_64>(shEnergyKin),
+                                ::alpaka::hierarchy::Blocks{});
+                            cupla::atomicAdd(
+                                acc,
+                                &(gEnergies[1]),
+                                static_cast<float_64>(shEnergy),
+                                ::alpaka::hierarchy::Blocks{});
+                        }
+                    });
+                }
+
+            private:
+                //! add kinetic and total energy of the particle
+                template<typename T_Particle>
+                DINLINE void addEnergies(
+                    T_Particle const& particle,
+                    float_X& energyKin,
+                    float_X& energy,
+                    std::true_type const) const
+                {
+                    float3_X const mom = particle[momentum_];
+                    // compute square of absolute momentum of the particle
+                    float_X const mom2 = pmacc::math::abs2(mom);
+                    float_X const weighting = particle[weighting_];
+                    float_X const mass = attribute::getMass(weighting, particle);
+                    float_X const c2 = SPEED_OF_LIGHT * SPEED_OF_LIGHT;
+
+                    // calculate kinetic energy of the macro particle
+                    energyKin += KinEnergy<>()(mom, mass);
+
+                    /* total energy for particles:
+                     *    E^2 = p^2*c^2 + m^2*c^4
+                     *        = c^2 * [p^2 + m^2*c^2]
+                     */
+                    energy += math::sqrt(mom2 + mass * mass * c2) * SPEED_OF_LIGHT;
+                }
+
+                //! species without momentum or mass have no energy
+                template<typename T_Particle>
+                DINLINE void addEnergies(T_Particle const&, float_X&, float_X&, std::false_type const) const
+                {
+                }
+            };
+
+            /** Particle sweep of a species shared by all diagnostics plugins requesting the same filter
+             *
+             * Plugins that only need sums over all particles (e.g. CountParticles and EnergyParticles) request them
+             * from this class instead of running an own kernel and MPI reduction.
+             * The first request on a time step runs a single kernel computing all sums for the requested filter
+             * and the MPI reductions. The results are reused by requests of plugins notified directly after each
+             * other on the same time step. Plugins that do not request sums, e.g. histograms like PhaseSpace or
+             * BinEnergyParticles, run their own kernels; if one of them is notified in between, the sums are
+             * computed again because it could have changed particles.
+             *
+             * All MPI ranks must request the same filters in the same order, as it is the case for plugins
+             * notified by the PluginConnector.
+             *
+             * @tparam T_Species species type
+             */
+            template<typename T_Species>
+            class SpeciesSweep
+            {
+            public:
+                using FrameType = typename T_Species::FrameType;
+
+                //! all filters eligible for the species
+                using EligibleFilters = typename MakeSeqFromNestedSeq<typename bmpl::transform<
+                    particles::filter::AllParticleFilters,
+                    particles::traits::GenerateSolversIfSpeciesEligible<bmpl::_1, T_Species>>::type>::type;
+
+                //! energies require the weighting and momentum attributes and a mass ratio
+                static constexpr bool hasEnergy = bmpl::and_<
+                    typename pmacc::traits::HasIdentifiers<FrameType, MakeSeq_t<weighting, momentum>>::type,
+                    typename pmacc::traits::HasFlag<FrameType, massRatio<>>::type>::type::value;
+
+                /** Get the sweep instance of the species
+                 *
+                 * The instance lives as long as a plugin holds the returned pointer,
+                 * so that device memory is freed together with the plugins.
+                 */
+                static std::shared_ptr<SpeciesSweep> get()
+                {
+                    static std::weak_ptr<SpeciesSweep> instance;
+                    auto sweep = instance.lock();
+                    if(!sweep)
+                    {
+                        sweep = std::shared_ptr<SpeciesSweep>(new SpeciesSweep{});
+                        instance = sweep;
+                    }
+                    return sweep;
+                }
+
+                /** Check if this MPI rank gets the reduced sums
+                 *
+                 * Only this rank should write the results.
+                 */
+                bool hasResult()
+                {
+                    return reduce.hasResult(mpi::reduceMethods::Reduce());
+                }
+
+                /** Get the sums over all particles in the global domain passing the filter
+                 *
+                 * @param currentStep index of the current time iteration
+                 * @param filterName name of a filter from EligibleFilters
+                 * @param cellDescription mapping for kernels
+                 * @return sums reduced over all MPI ranks, only valid if hasResult()
+                 */
+                ParticleSums const& getSums(
+                    uint32_t const currentStep,
+                    std::string const& filterName,
+                    MappingDesc const& cellDescription)
+                {
+                    uint64_t const generation
+                        = detail::getCacheGeneration(Environment<>::get().PluginConnector().getNumNotifications());
+                    if(currentStep != cachedStep || generation != cachedGeneration)
+                    {
+                        cachedSums.clear();
+                        cachedStep = currentStep;
+                        cachedGeneration = generation;
+                    }
+                    auto cached = cachedSums.find(filterName);
+                    if(cached != cachedSums.end())
+                        return cached->second;
+
+                    DataConnector& dc = Environment<>::get().DataConnector();
+                    auto particles = dc.get<T_Species>(FrameType::getName(), true);
+
+                    // initialize global sums with zero
+                    gCount->getDeviceBuffer().setValue(0u);
+                    gEnergies->getDeviceBuffer().setValue(0.0);
+
+                    constexpr uint32_t numWorkers
+                        = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
+
+                    auto const mapper = makeAreaMapper<CORE + BORDER>(cellDescription);
+
+                    auto kernel = PMACC_KERNEL(KernelParticleSums<numWorkers, hasEnergy>{})(
+                        mapper.getGridDim(),
+                        numWorkers);
+                    auto binaryKernel = std::bind(
+                        kernel,
+                        particles->getDeviceParticlesBox(),
+                        gCount->getDeviceBuffer().getDataBox(),
+                        gEnergies->getDeviceBuffer().getDataBox(),
+                        mapper,
+                        std::placeholders::_1);
+
+                    meta::ForEach<EligibleFilters, ExecuteIfNameIsEqual<bmpl::_1>>{}(
+                        filterName,
+                        currentStep,
+                        binaryKernel);
+
+                    auto& sums = cachedSums[filterName];
+
+                    // add sums from all GPUs
+                    gCount->deviceToHost();
+                    reduce(
+                        pmacc::math::operation::Add(),
+                        &sums.numMacroParticles,
+                        gCount->getHostBuffer().getBasePointer(),
+                        1,
+                        mpi::reduceMethods::Reduce());
+
+                    if(hasEnergy)
+                    {
+                        gEnergies->deviceToHost();
+                        float_64 reducedEnergies[ParticleSums::numEnergies];
+                        reduce(
+                            pmacc::math::operation::Add(),
+                            reducedEnergies,
+                            gEnergies->getHostBuffer().getBasePointer(),
+                            ParticleSums::numEnergies,
+                            mpi::reduceMethods::Reduce());
+                        sums.energyKin = reducedEnergies[0];
+                        sums.energy = reducedEnergies[1];
+                    }
+                    return sums;
+                }
+
+            private:
+                SpeciesSweep()
+                    : gCount(std::make_unique<GridBuffer<uint64_cu, DIM1>>(DataSpace<DIM1>(1)))
+                    , gEnergies(
+                          std::make_unique<GridBuffer<float_64, DIM1>>(DataSpace<DIM1>(ParticleSums::numEnergies)))
+                {
+                }
+
+                //! number of macro particles of the local domain (global on GPU)
+                std::unique_ptr<GridBuffer<uint64_cu, DIM1>> gCount;
+
+                //! energies of the local domain (global on GPU)
+                std::unique_ptr<GridBuffer<float_64, DIM1>> gEnergies;
+
+                //! MPI reduce to add the sums over all GPUs
+                mpi::MPIReduce reduce;
+
+                //! time step of the cached sums
+                uint32_t cachedStep = std::numeric_limits<uint32_t>::max();
+
+                //! generation of the cached sums, see detail::getCacheGeneration()
+                uint64_t cachedGeneration = 0u;
+
+                //! reduced sums of the cached time step for each requested filter name
+                std::map<std::string, ParticleSums> cachedSums;
+            };
+
+        } // namespace misc
+    } // namespace plugins
+} // namespace picongpu
@@ -51,6 +51,16 @@ namespace picongpu
                 //! create a check point for the plugin
                 virtual void checkpoint(uint32_t currentStep, std::string const& checkpointDirectory) = 0;
 
+                /** Called by Master::pluginUnload() before the instance is destroyed
+                 *
+                 * All MPI ranks unload the plugins together while MPI is still initialized, so
+                 * pending collective operations, e.g. a non-blocking reduce started in notify(),
+                 * must be completed here and not in the destructor.
+                 */
+                virtual void pluginUnload()
+                {
+                }
+
                 /**
                  * Called each timestep if particles are leaving the global simulation volume.
                  *
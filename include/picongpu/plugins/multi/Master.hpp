@@ -126,6 +126,8 @@ namespace picongpu
 
                 void pluginUnload() override
                 {
+                    for(auto& instance : instanceList)
+                        instance->pluginUnload();
                     instanceList.clear();
                 }
 
@@ -0,0 +1,118 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/communication/manager_common.hpp>
+
+#include <openPMD/openPMD.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mpi.h>
+
+
+namespace picongpu
+{
+    namespace openPMD
+    {
+        /** Finalizes openPMD iterations on background threads
+         *
+         * The host side of an output step (device to host copies, filling openPMD buffers) is done by the
+         * simulation thread with all flushes deferred. The Series is then handed over to this class which
+         * flushes and closes it while the simulation continues.
+         *
+         * Each submitted Series must be exclusively owned by the job and use its own MPI communicator,
+         * collective MPI calls of concurrent jobs are therefore independent of each other and of the
+         * simulation. The number of jobs in flight is bounded, submitting waits for the oldest job if
+         * the bound is reached.
+         */
+        class AsyncWriter
+        {
+        public:
+            /** constructor
+             *
+             * @param maxInFlight maximum number of iterations written concurrently, must be > 0
+             */
+            explicit AsyncWriter(uint32_t maxInFlight) : m_maxInFlight(maxInFlight)
+            {
+            }
+
+            AsyncWriter(AsyncWriter const&) = delete;
+            AsyncWriter& operator=(AsyncWriter const&) = delete;
+
+            ~AsyncWriter()
+            {
+                // exceptions of the jobs can not be reported anymore
+                for(auto& job : m_inFlight)
+                    job.wait();
+            }
+
+            /** Flush and close an iteration in the background
+             *
+             * @param series Series owned by the job, will be destroyed by the background thread
+             * @param communicator communicator used by series, will be freed by the background thread
+             * @param iteration iteration to close
+             */
+            void submit(std::unique_ptr<::openPMD::Series> series, MPI_Comm communicator, uint64_t iteration)
+            {
+                while(m_inFlight.size() >= m_maxInFlight)
+                    waitForOldest();
+
+                std::shared_ptr<::openPMD::Series> job(std::move(series));
+                m_inFlight.push_back(std::async(std::launch::async, [job, communicator, iteration]() mutable {
+                    job->WRITE_ITERATIONS[iteration].close();
+                    // the destructor of the Series finalizes the file
+                    job.reset();
+                    MPI_CHECK(MPI_Comm_free(&communicator));
+                }));
+            }
+
+            /** wait until all submitted iterations are written
+             *
+             * Rethrows the exception of a failed background write.
+             */
+            void waitForAll()
+            {
+                while(!m_inFlight.empty())
+                    waitForOldest();
+            }
+
+            //! number of iterations currently written in the background
+            size_t getNumInFlight() const
+            {
+                return m_inFlight.size();
+            }
+
+        private:
+            void waitForOldest()
+            {
+                auto job = std::move(m_inFlight.front());
+                m_inFlight.pop_front();
+                job.get();
+            }
+
+            uint32_t const m_maxInFlight;
+            std::deque<std::future<void>> m_inFlight;
+        };
+
+    } // namespace openPMD
+} // namespace picongpu
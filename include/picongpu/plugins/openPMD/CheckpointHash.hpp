@@ -0,0 +1,126 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/traits/Resolve.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+
+namespace picongpu
+{
+    namespace openPMD
+    {
+        namespace detail
+        {
+            constexpr uint64_t hashPrime1 = 0x9e3779b185ebca87ull;
+            constexpr uint64_t hashPrime2 = 0xc2b2ae3d27d4eb4full;
+
+            inline uint64_t rotateLeft(uint64_t const value, uint32_t const shift)
+            {
+                return (value << shift) | (value >> (64u - shift));
+            }
+
+            //! add a 64 bit word to one hash lane
+            inline uint64_t hashRound(uint64_t const lane, uint64_t const word)
+            {
+                return rotateLeft(lane + word * hashPrime2, 31u) * hashPrime1;
+            }
+
+            //! final avalanche, every input bit affects every output bit
+            inline uint64_t hashFinalize(uint64_t value)
+            {
+                value ^= value >> 33u;
+                value *= 0xff51afd7ed558ccdull;
+                value ^= value >> 33u;
+                value *= 0xc4ceb9fe1a85ec53ull;
+                value ^= value >> 33u;
+                return value;
+            }
+        } // namespace detail
+
+        /** 64 bit hash of a memory block
+         *
+         * Used to detect checkpoint data which did not change since the last full checkpoint.
+         * Four independent lanes keep the hash bound by memory bandwidth instead of multiplication latency.
+         * This is no cryptographic hash.
+         *
+         * @param data begin of the memory block
+         * @param numBytes size of the memory block in bytes
+         * @param seed hash of previous blocks, allows to hash several blocks into one value
+         */
+        inline uint64_t hashMemory(void const* data, size_t const numBytes, uint64_t const seed = 0u)
+        {
+            char const* bytes = static_cast<char const*>(data);
+            uint64_t lanes[4]
+                = {seed + detail::hashPrime1, seed ^ detail::hashPrime2, seed, seed - detail::hashPrime1};
+
+            size_t const blockSize = 4u * sizeof(uint64_t);
+            size_t const numBlocks = numBytes / blockSize;
+            for(size_t b = 0u; b < numBlocks; ++b)
+            {
+                uint64_t words[4];
+                std::memcpy(words, bytes + b * blockSize, blockSize);
+                for(uint32_t l = 0u; l < 4u; ++l)
+                    lanes[l] = detail::hashRound(lanes[l], words[l]);
+            }
+
+            // bytes of an incomplete last block
+            uint64_t tail[4] = {0u, 0u, 0u, 0u};
+            std::memcpy(tail, bytes + numBlocks * blockSize, numBytes - numBlocks * blockSize);
+            for(uint32_t l = 0u; l < 4u; ++l)
+                lanes[l] = detail::hashRound(lanes[l], tail[l]);
+
+            uint64_t hash = static_cast<uint64_t>(numBytes);
+            for(uint32_t l = 0u; l < 4u; ++l)
+                hash = detail::hashFinalize(hash ^ detail::rotateLeft(lanes[l], 1u + 16u * l));
+            return hash;
+        }
+
+        /** hash the values of a particle attribute in a host frame
+         *
+         * @tparam T_Identifier identifier of a particle attribute
+         */
+        template<typename T_Identifier>
+        struct HashParticleAttribute
+        {
+            /** add the attribute values to a hash
+             *
+             * @param frame frame with contiguous attribute values
+             * @param numParticles number of particles in the frame
+             * @param[in,out] hash hash of the previous attributes, updated with this attribute
+             */
+            template<typename T_Frame>
+            HINLINE void operator()(T_Frame& frame, uint64_t const numParticles, uint64_t& hash) const
+            {
+                using ValueType = typename pmacc::traits::Resolve<T_Identifier>::type::type;
+                if(numParticles == 0u)
+                    return;
+                auto const* dataPtr = frame.getIdentifier(T_Identifier()).getPointer();
+                hash = hashMemory(dataPtr, numParticles * sizeof(ValueType), hash);
+            }
+        };
+    } // namespace openPMD
+} // namespace picongpu
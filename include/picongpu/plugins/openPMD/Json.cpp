@@ -125,6 +125,25 @@ namespace picongpu
                     m_perBackend.emplace_back(PerBackend{backendName, MatcherPerBackend{it.value().at("dataset")}});
                 }
             }
+            auto precisionConfig = m_wholeConfig.find("picongpu");
+            if(precisionConfig != m_wholeConfig.end())
+            {
+                if(!precisionConfig->is_object() || !precisionConfig->contains("dataset"))
+                {
+                    throw std::runtime_error("[openPMD plugin] The configuration for 'picongpu' must be a JSON object "
+                                             "with key 'dataset'.");
+                }
+                auto const& datasetConfig = precisionConfig->at("dataset");
+                m_precision = MatcherPerBackend{datasetConfig};
+                // validate all configurations now instead of in the first output
+                if(datasetConfig.is_array())
+                    for(auto const& pattern : datasetConfig)
+                        readPrecision(pattern.at("cfg"));
+                else
+                    readPrecision(datasetConfig);
+                // PIConGPU-specific, openPMD does not know this key
+                m_wholeConfig.erase(precisionConfig);
+            }
         }
         std::string JsonMatcher::get(std::string const& datasetPath) const
         {
@@ -166,6 +185,12 @@ namespace picongpu
             return result.dump();
         }
 
+        OutputPrecision JsonMatcher::getPrecision(std::string const& datasetPath) const
+        {
+            auto const& datasetConfig = m_precision.get(datasetPath);
+            return readPrecision(datasetConfig.is_null() ? m_precision.getDefault() : datasetConfig);
+        }
+
         std::unique_ptr<AbstractJsonMatcher> AbstractJsonMatcher::construct(std::string const& config, MPI_Comm comm)
         {
             return std::unique_ptr<AbstractJsonMatcher>{new JsonMatcher{config, comm}};
@@ -343,6 +368,32 @@ The key 'select' must point to either a single string or an array of strings.)EN
             throw std::runtime_error(errorMsg);
         }
     }
+
+    picongpu::json::OutputPrecision readPrecision(nlohmann::json const& config)
+    {
+        static std::string const errorMsg = R"END(
+[openPMD plugin] The dataset configuration for 'picongpu' must be a JSON object
+with the optional keys 'datatype' ("float32"), 'mantissaBits' (0 to 52)
+and 'positionBits' (0 to 32).)END";
+
+        picongpu::json::OutputPrecision precision;
+        if(config.is_null())
+            return precision;
+        if(!config.is_object())
+            throw std::runtime_error(errorMsg);
+        for(auto it = config.begin(); it != config.end(); ++it)
+        {
+            if(it.key() == "datatype" && it.value() == "float32")
+                precision.float32 = true;
+            else if(it.key() == "mantissaBits" && it.value().is_number_unsigned() && it.value() <= 52u)
+                precision.mantissaBits = it.value().get<uint32_t>();
+            else if(it.key() == "positionBits" && it.value().is_number_unsigned() && it.value() <= 32u)
+                precision.positionBits = it.value().get<uint32_t>();
+            else
+                throw std::runtime_error(errorMsg);
+        }
+        return precision;
+    }
 } // namespace
 
 #endif // ENABLE_OPENPMD
@@ -19,6 +19,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <memory> // std::unique_ptr
 #include <string>
 
@@ -28,6 +29,29 @@ namespace picongpu
 {
     namespace json
     {
+        /**
+         * @brief Output precision of a dataset, as configured for the
+         *        pseudo backend "picongpu" in the JSON configuration.
+         *
+         * Default values keep the data unchanged.
+         */
+        struct OutputPrecision
+        {
+            //! Store 64 bit floating point data as 32 bit floating point data, key "datatype": "float32"
+            bool float32 = false;
+            /** Number of explicitly stored mantissa bits floating point data is rounded to,
+             *  key "mantissaBits", 0 keeps all bits.
+             *  E.g. 10 results in the precision of IEEE half, 7 in the precision of bfloat16.
+             *  The cleared trailing bits are compressed well by lossless compressors.
+             */
+            uint32_t mantissaBits = 0u;
+            /** Number of bits in-cell positions are quantized to, key "positionBits", 0 keeps floating point data.
+             *  Quantized positions are stored as unsigned integers, the unitSI of the record component is scaled
+             *  accordingly.
+             */
+            uint32_t positionBits = 0u;
+        };
+
         /**
          * @brief Class to handle extended JSON configurations as used by
          *        the openPMD plugin.
@@ -72,6 +96,20 @@ namespace picongpu
              * @return The default JSON configuration, as a string.
              */
             virtual std::string getDefault() const = 0;
+
+            /**
+             * @brief Get the output precision associated with a dataset.
+             *
+             * The precision is configured by PIConGPU and not forwarded to
+             * openPMD, e.g.
+             * {"picongpu": {"dataset": [{"select": "E/.*", "cfg": {"mantissaBits": 10}}]}}.
+             * Dataset-specific and default configurations follow the
+             * extended format of the backend configurations.
+             *
+             * @param datasetPath The dataset path.
+             * @return The matched output precision.
+             */
+            virtual OutputPrecision getPrecision(std::string const& datasetPath) const = 0;
         };
     } // namespace json
 } // namespace picongpu
@@ -125,6 +125,8 @@ namespace picongpu
                 MatcherPerBackend matcher;
             };
             std::vector<PerBackend> m_perBackend;
+            //! configuration of the pseudo backend "picongpu", not forwarded to openPMD
+            MatcherPerBackend m_precision;
             nlohmann::json m_wholeConfig;
             static std::vector<std::string> const m_recognizedBackends;
 
@@ -171,6 +173,14 @@ namespace picongpu
              * @return The default JSON configuration, as a string.
              */
             std::string getDefault() const override;
+
+            /**
+             * @brief Get the output precision associated with a dataset.
+             *
+             * @param datasetPath The dataset path.
+             * @return The matched output precision.
+             */
+            OutputPrecision getPrecision(std::string const& datasetPath) const override;
         };
 
         std::vector<std::string> const JsonMatcher::m_recognizedBackends = {"adios2", "hdf5", "json"};
@@ -269,4 +279,12 @@ namespace
         std::vector<picongpu::json::Pattern>& patterns,
         nlohmann::json& defaultConfig,
         nlohmann::json const& object);
+
+    /**
+     * @brief Read the output precision from a configuration of the pseudo backend "picongpu".
+     *
+     * @param config The matched configuration, may be null.
+     * @return The output precision, default values if the configuration is null.
+     */
+    picongpu::json::OutputPrecision readPrecision(nlohmann::json const& config);
 } // namespace
@@ -0,0 +1,100 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+
+namespace picongpu
+{
+    namespace openPMD
+    {
+        namespace detail
+        {
+            template<typename T_Float>
+            inline T_Float roundMantissa(T_Float const value, uint32_t const mantissaBits, std::true_type)
+            {
+                using Bits = std::conditional_t<sizeof(T_Float) == sizeof(uint64_t), uint64_t, uint32_t>;
+                static_assert(sizeof(Bits) == sizeof(T_Float), "Unsupported floating point type.");
+                constexpr uint32_t storedMantissaBits = std::numeric_limits<T_Float>::digits - 1;
+                constexpr uint32_t exponentBits = sizeof(Bits) * 8u - 1u - storedMantissaBits;
+                constexpr Bits exponentMask = ((Bits{1} << exponentBits) - Bits{1}) << storedMantissaBits;
+
+                if(mantissaBits == 0u || mantissaBits >= storedMantissaBits)
+                    return value;
+
+                Bits bits;
+                std::memcpy(&bits, &value, sizeof(Bits));
+                // keep infinity and NaN
+                if((bits & exponentMask) == exponentMask)
+                    return value;
+
+                // round half to even, a carry into the exponent is the correctly rounded result
+                uint32_t const droppedBits = storedMantissaBits - mantissaBits;
+                Bits const lowestKeptBit = (bits >> droppedBits) & Bits{1};
+                bits += (Bits{1} << (droppedBits - 1u)) - Bits{1} + lowestKeptBit;
+                bits &= ~((Bits{1} << droppedBits) - Bits{1});
+
+                T_Float result;
+                std::memcpy(&result, &bits, sizeof(Bits));
+                return result;
+            }
+
+            template<typename T_Value>
+            inline T_Value roundMantissa(T_Value const value, uint32_t const, std::false_type)
+            {
+                return value;
+            }
+        } // namespace detail
+
+        /** Round a value to the given number of explicitly stored mantissa bits
+         *
+         * Non floating point values, infinity and NaN are not changed.
+         *
+         * @param value value to round
+         * @param mantissaBits number of mantissa bits to keep, 0 keeps all bits
+         */
+        template<typename T_Value>
+        inline T_Value roundMantissa(T_Value const value, uint32_t const mantissaBits)
+        {
+            return detail::roundMantissa(value, mantissaBits, std::is_floating_point<T_Value>{});
+        }
+
+        /** Quantize an in-cell position
+         *
+         * The result multiplied with 2^-positionBits is the position rounded to the nearest representable value.
+         *
+         * @tparam T_Int unsigned integer type with at least positionBits bits
+         * @param position in-cell position in [0;1)
+         * @param positionBits number of bits of the quantized position, range [1;32]
+         */
+        template<typename T_Int, typename T_Float>
+        inline T_Int quantizePosition(T_Float const position, uint32_t const positionBits)
+        {
+            uint64_t const numValues = uint64_t{1} << positionBits;
+            double const scaled = std::max(static_cast<double>(position) * static_cast<double>(numValues), 0.0);
+            return static_cast<T_Int>(std::min(static_cast<uint64_t>(scaled + 0.5), numValues - 1u));
+        }
+    } // namespace openPMD
+} // namespace picongpu
@@ -26,6 +26,7 @@
 #include "picongpu/plugins/ISimulationPlugin.hpp"
 #include "picongpu/plugins/common/openPMDVersion.def"
 #include "picongpu/plugins/kernel/CopySpecies.kernel"
+#include "picongpu/plugins/openPMD/CheckpointHash.hpp"
 #include "picongpu/plugins/openPMD/openPMDDimension.hpp"
 #include "picongpu/plugins/openPMD/openPMDWriter.def"
 #include "picongpu/plugins/openPMD/writer/ParticleAttribute.hpp"
@@ -434,6 +435,44 @@ namespace picongpu
                 {
                     strategy->prepare(T_SpeciesFilter::getName(), hostFrame, std::move(runParameters));
                 }
+
+                // checkpoints omit local particles which did not change since the last full checkpoint
+                uint64_t particleHash = 0u;
+                if(params->isCheckpoint)
+                {
+                    particleHash = hashMemory(&myNumParticles, sizeof(myNumParticles));
+                    meta::ForEach<typename openPMDFrameType::ValueTypeSeq, HashParticleAttribute<bmpl::_1>>
+                        hashAttributes;
+                    hashAttributes(hostFrame, myNumParticles, particleHash);
+                }
+                bool const isUnchanged
+                    = params->skipUnchangedCheckpointData("particles_" + speciesGroup, particleHash);
+
+                uint64_t writtenNumParticles = isUnchanged ? 0u : myNumParticles;
+                uint64_t globalWrittenNumParticles = globalNumParticles;
+                uint64_t writtenParticleOffset = myParticleOffset;
+                if(params->isIncrementalCheckpoint)
+                {
+                    __getTransactionEvent().waitForFinished();
+                    MPI_CHECK(MPI_Allgather(
+                        &writtenNumParticles,
+                        1,
+                        MPI_UINT64_T,
+                        allNumParticles,
+                        1,
+                        MPI_UINT64_T,
+                        gc.getCommunicator().getMPIComm()));
+
+                    globalWrittenNumParticles = 0u;
+                    writtenParticleOffset = 0u;
+                    for(uint64_t i = 0; i < mpiSize; ++i)
+                    {
+                        globalWrittenNumParticles += allNumParticles[i];
+                        if(i < mpiRank)
+                            writtenParticleOffset += allNumParticles[i];
+                    }
+                }
+
                 log<picLog::INPUT_OUTPUT>("openPMD:  (begin) write particle records for %1%")
                     % T_SpeciesFilter::getName();
 
@@ -444,9 +483,9 @@ namespace picongpu
                     hostFrame,
                     particleSpecies,
                     basename,
-                    myNumParticles,
-                    globalNumParticles,
-                    myParticleOffset);
+                    writtenNumParticles,
+                    globalWrittenNumParticles,
+                    writtenParticleOffset);
 
                 log<picLog::INPUT_OUTPUT>("openPMD:  (begin) free memory: %1%") % T_SpeciesFilter::getName();
                 /* free host memory */
@@ -478,8 +517,8 @@ namespace picongpu
                     /* It is safe to use the mpi rank to write the data even if the rank can differ between simulation
                      * runs. During the restart the plugin is using patch information to find the corresponding data.
                      */
-                    numParticles.store<index_t>(mpiRank, myNumParticles);
-                    numParticlesOffset.store<index_t>(mpiRank, myParticleOffset);
+                    numParticles.store<index_t>(mpiRank, writtenNumParticles);
+                    numParticlesOffset.store<index_t>(mpiRank, writtenParticleOffset);
 
                     ::openPMD::PatchRecord offset = particlePatches["offset"];
                     ::openPMD::PatchRecord extent = particlePatches["extent"];
@@ -505,10 +544,10 @@ namespace picongpu
                     /* openPMD ED-PIC: additional attributes */
                     setParticleAttributes(
                         particleSpecies,
-                        globalNumParticles,
+                        globalWrittenNumParticles,
                         *params->jsonMatcher,
                         series.particlesPath() + speciesGroup);
-                    params->openPMDSeries->flush();
+                    params->flush();
                 }
 
                 log<picLog::INPUT_OUTPUT>("openPMD: ( end ) writing particle patches for %1%")
@@ -36,8 +36,11 @@
 #include "picongpu/plugins/misc/misc.hpp"
 #include "picongpu/plugins/multi/IHelp.hpp"
 #include "picongpu/plugins/multi/Option.hpp"
+#include "picongpu/plugins/openPMD/AsyncWriter.hpp"
+#include "picongpu/plugins/openPMD/CheckpointHash.hpp"
 #include "picongpu/plugins/openPMD/Json.hpp"
 #include "picongpu/plugins/openPMD/NDScalars.hpp"
+#include "picongpu/plugins/openPMD/OutputPrecision.hpp"
 #include "picongpu/plugins/openPMD/WriteSpecies.hpp"
 #include "picongpu/plugins/openPMD/openPMDWriter.def"
 #include "picongpu/plugins/openPMD/restart/LoadSpecies.hpp"
@@ -67,9 +70,13 @@
 #include <boost/filesystem.hpp>
 #include <boost/mpl/at.hpp>
 #include <boost/mpl/begin_end.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/copy_if.hpp>
 #include <boost/mpl/find.hpp>
+#include <boost/mpl/identity.hpp>
 #include <boost/mpl/pair.hpp>
 #include <boost/mpl/size.hpp>
+#include <boost/mpl/transform.hpp>
 #include <boost/mpl/vector.hpp>
 
 #include <openPMD/openPMD.hpp>
@@ -81,9 +88,12 @@
 #include <algorithm>
 #include <cstdint>
 #include <cstdlib> // getenv
+#include <iterator>
 #include <list>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <pthread.h>
@@ -126,7 +136,7 @@ namespace picongpu
             return res;
         }
 
-        ::openPMD::Series& ThreadParams::openSeries(::openPMD::Access at)
+        ::openPMD::Series& ThreadParams::openSeries(::openPMD::Access at, MPI_Comm seriesCommunicator)
         {
             if(!openPMDSeries)
             {
@@ -138,7 +148,7 @@ namespace picongpu
                 openPMDSeries = std::make_unique<::openPMD::Series>(
                     fullName,
                     at,
-                    communicator,
+                    seriesCommunicator == MPI_COMM_NULL ? communicator : seriesCommunicator,
                     /*
                      * The openPMD plugin only supports configuring writing routines via JSON.
                      * Reading routines get an empty JSON set.
@@ -183,6 +193,57 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
             }
         }
 
+        void ThreadParams::flush()
+        {
+            if(!deferFlush)
+                openPMDSeries->flush();
+        }
+
+        json::OutputPrecision ThreadParams::getPrecision(std::string const& datasetName) const
+        {
+            // restarts require the data as simulated
+            if(isCheckpoint)
+                return json::OutputPrecision{};
+            return jsonMatcher->getPrecision(datasetName);
+        }
+
+        bool ThreadParams::skipUnchangedCheckpointData(std::string const& group, uint64_t const hash)
+        {
+            if(!isCheckpoint)
+                return false;
+            if(!isIncrementalCheckpoint)
+            {
+                fullCheckpointHashes[group] = hash;
+                return false;
+            }
+
+            auto const fullHash = fullCheckpointHashes.find(group);
+            bool const isUnchanged = fullHash != fullCheckpointHashes.end() && fullHash->second == hash;
+            WriteNDScalars<uint32_t> writeCheckpointSource("picongpu", "checkpointSource", group);
+            writeCheckpointSource(*this, isUnchanged ? fullCheckpointStep : currentStep);
+            return isUnchanged;
+        }
+
+        uint32_t ThreadParams::getCheckpointSource(std::string const& group)
+        {
+            std::string const meshName = "picongpu_checkpointSource";
+            ::openPMD::Iteration iteration = openPMDSeries->iterations[currentStep];
+            // full checkpoints hold all data themselves
+            if(!iteration.meshes.contains(meshName) || !iteration.meshes[meshName].contains(group))
+                return currentStep;
+
+            DataSpace<simDim> gpuNodes = Environment<simDim>::get().GridController().getGpuNodes();
+            if(iteration.meshes[meshName][group].getExtent()
+               != asStandardVector<DataSpace<simDim>&, ::openPMD::Extent>(gpuNodes))
+                throw std::runtime_error(
+                    "openPMD: restarting from an incremental checkpoint requires the domain decomposition used "
+                    "to write it");
+
+            uint32_t source = currentStep;
+            ReadNDScalars<uint32_t>{}(*this, "picongpu", "checkpointSource", group, &source);
+            return source;
+        }
+
 
         struct Help : public plugins::multi::IHelp
         {
@@ -223,6 +284,13 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
             plugins::multi::Option<std::string> jsonConfig
                 = {"json", "advanced (backend) configuration for openPMD in JSON format", "{}"};
 
+            plugins::multi::Option<uint32_t> asyncWrites
+                = {"asyncWrites",
+                   "number of output iterations flushed in the background while the simulation continues, "
+                   "0 writes synchronously. Requires the ADIOS2 backend (ext=bp), a file-based iteration layout "
+                   "and MPI_THREAD_MULTIPLE (PMACC_MPI_THREAD_MULTIPLE=ON).",
+                   0};
+
             plugins::multi::Option<std::string> dataPreparationStrategy
                 = {"dataPreparationStrategy",
                    "Strategy for preparation of particle data ('doubleBuffer' or "
@@ -275,6 +343,7 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
                 notifyPeriod.registerHelp(desc, masterPrefix + prefix);
                 source.registerHelp(desc, masterPrefix + prefix, std::string("[") + concatenatedSourceNames + "]");
+                asyncWrites.registerHelp(desc, masterPrefix + prefix);
 
                 expandHelp(desc, "");
                 selfRegister = true;
@@ -474,10 +543,105 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 }
             };
 
+            /** check if a field is a FieldTmp operation which can be computed together with T_FieldTmpOperation
+             *
+             * Operations can be computed in one pass over the particles if they use the same
+             * species and filter but a different solver.
+             */
+            template<typename T_Field, typename T_FieldTmpOperation>
+            struct IsBatchableFieldTmpOperation : bmpl::false_
+            {
+            };
+
+            template<typename T_Solver, typename T_OtherSolver, typename T_Species, typename T_Filter>
+            struct IsBatchableFieldTmpOperation<
+                FieldTmpOperation<T_Solver, T_Species, T_Filter>,
+                FieldTmpOperation<T_OtherSolver, T_Species, T_Filter>>
+                : bmpl::bool_<!std::is_same<T_Solver, T_OtherSolver>::value>
+            {
+            };
+
+            //! get the frame solver of a FieldTmp operation
+            template<typename T_FieldTmpOperation>
+            struct GetFieldTmpSolver
+            {
+                using type = typename T_FieldTmpOperation::Solver;
+            };
+
+            /** write a FieldTmp operation which was computed as part of a batch
+             *
+             * The operation is skipped if no slot was assigned to it.
+             */
+            template<typename T_FieldTmpOperation>
+            struct WriteFieldTmpSlot
+            {
+                using Solver = typename T_FieldTmpOperation::Solver;
+                using UnitType = typename FieldTmp::UnitValueType;
+                using ValueType = typename FieldTmp::ValueType;
+                using ComponentType = typename GetComponentsType<ValueType>::type;
+
+                /** write the operation
+                 *
+                 * @param params thread parameters of the current dump
+                 * @param names names of all operations of the batch
+                 * @param slots FieldTmp slot of each operation in names, -1 if not computed
+                 */
+                void operator()(
+                    ThreadParams* params,
+                    std::vector<std::string> const& names,
+                    std::vector<int> const& slots) const
+                {
+                    std::string const name = T_FieldTmpOperation::getName();
+                    auto const nameIt = std::find(names.begin(), names.end(), name);
+                    int const slot = slots[std::distance(names.begin(), nameIt)];
+                    if(slot < 0 || params->writtenFieldTmpOperations.count(name) != 0u)
+                        return;
+
+                    DataConnector& dc = Environment<>::get().DataConnector();
+                    auto fieldTmp = dc.get<FieldTmp>(FieldTmp::getUniqueId(slot), true);
+
+                    const uint32_t components = GetNComponents<ValueType>::value;
+                    UnitType const unit = FieldTmp::getUnit<Solver>();
+
+                    /*wrap in a one-component vector for writeField API*/
+                    const traits::FieldPosition<typename fields::CellType, FieldTmp> fieldPos;
+
+                    std::vector<std::vector<float_X>> inCellPosition;
+                    std::vector<float_X> inCellPositonComponent;
+                    for(uint32_t d = 0; d < simDim; ++d)
+                        inCellPositonComponent.push_back(fieldPos()[0][d]);
+                    inCellPosition.push_back(inCellPositonComponent);
+
+                    /** \todo check if always correct at this point, depends on
+                     * solver implementation */
+                    const float_X timeOffset = 0.0;
+
+                    params->gridLayout = fieldTmp->getGridLayout();
+                    bool const isDomainBound = traits::IsFieldDomainBound<FieldTmp>::value;
+                    /*write data to openPMD Series*/
+                    openPMDWriter::template writeField<ComponentType>(
+                        params,
+                        components,
+                        name,
+                        fieldTmp->getHostDataBox().getPointer(),
+                        createUnit(unit, components),
+                        FieldTmp::getUnitDimension<Solver>(),
+                        std::move(inCellPosition),
+                        timeOffset,
+                        isDomainBound);
+
+                    params->writtenFieldTmpOperations.insert(name);
+                }
+            };
+
             /** Calculate FieldTmp with given solver, particle species, and filter
              * and write them to openPMD.
              *
              * FieldTmp is calculated on device and then dumped to openPMD.
+             * All other operations in FileOutputFields with the same species and
+             * filter which are selected for this dump are computed in the same pass
+             * over the particles, one per free FieldTmp slot (see fieldTmpNumSlots
+             * in memory.param).
              */
             template<typename Solver, typename Species, typename Filter>
             struct GetFields<FieldTmpOperation<Solver, Species, Filter>>
@@ -498,75 +662,83 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 }
 
             private:
-                using UnitType = typename FieldTmp::UnitValueType;
                 using ValueType = typename FieldTmp::ValueType;
-                using ComponentType = typename GetComponentsType<ValueType>::type;
+                using Operation = FieldTmpOperation<Solver, Species, Filter>;
 
-                /** Get the unit for the result from the solver*/
-                static std::vector<float_64> getUnit()
-                {
-                    UnitType unit = FieldTmp::getUnit<Solver>();
-                    const uint32_t components = GetNComponents<ValueType>::value;
-                    return createUnit(unit, components);
-                }
-
-                /** Create a name for the openPMD identifier.
-                 */
-                static std::string getName()
-                {
-                    return FieldTmpOperation<Solver, Species, Filter>::getName();
-                }
+                //! operations which can be computed together with this one, this operation is the first
+                using BatchOperations = MakeSeq_t<
+                    Operation,
+                    typename bmpl::copy_if<FileOutputFields, IsBatchableFieldTmpOperation<bmpl::_1, Operation>>::
+                        type>;
+                using BatchSolvers = typename bmpl::transform<BatchOperations, GetFieldTmpSolver<bmpl::_1>>::type;
 
                 HINLINE void operator_impl(ThreadParams* params)
                 {
+                    // already written together with another operation
+                    if(params->writtenFieldTmpOperations.count(Operation::getName()) != 0u)
+                        return;
+
+                    PMACC_CASSERT_MSG(_please_allocate_at_least_one_FieldTmp_in_memory_param, fieldTmpNumSlots > 0);
+
+                    std::vector<std::string> names;
+                    meta::ForEach<BatchOperations, plugins::misc::AppendName<bmpl::_1>>{}(names);
+
+                    /* assign a slot to this operation and to all other selected operations
+                     * which are not written yet, as long as slots are available
+                     */
+                    std::vector<int> slots(names.size(), -1);
+                    uint32_t numUsedSlots = 0u;
+                    for(size_t i = 0u; i < names.size() && numUsedSlots < fieldTmpNumSlots; ++i)
+                    {
+                        bool const isSelected = i == 0u || params->requestedFields.count(names[i]) != 0u;
+                        bool const isDuplicate
+                            = std::find(names.begin(), names.begin() + i, names[i]) != names.begin() + i;
+                        if(isSelected && !isDuplicate && params->writtenFieldTmpOperations.count(names[i]) == 0u)
+                            slots[i] = static_cast<int>(numUsedSlots++);
+                    }
+
                     DataConnector& dc = Environment<>::get().DataConnector();
 
                     /*## update field ##*/
 
                     /*load FieldTmp without copy data to host*/
-                    PMACC_CASSERT_MSG(_please_allocate_at_least_one_FieldTmp_in_memory_param, fieldTmpNumSlots > 0);
-                    auto fieldTmp = dc.get<FieldTmp>(FieldTmp::getUniqueId(0), true);
+                    std::vector<std::shared_ptr<FieldTmp>> fieldTmps;
+                    for(uint32_t slot = 0u; slot < numUsedSlots; ++slot)
+                    {
+                        fieldTmps.push_back(dc.get<FieldTmp>(FieldTmp::getUniqueId(slot), true));
+                        fieldTmps.back()->getGridBuffer().getDeviceBuffer().setValue(ValueType::create(0.0));
+                    }
                     /*load particle without copy particle data to host*/
                     auto speciesTmp = dc.get<Species>(Species::FrameType::getName(), true);
 
-                    fieldTmp->getGridBuffer().getDeviceBuffer().setValue(ValueType::create(0.0));
                     /*run algorithm*/
-                    fieldTmp->template computeValue<CORE + BORDER, Solver, Filter>(*speciesTmp, params->currentStep);
+                    if(numUsedSlots == 1u)
+                    {
+                        // only this operation is computed, slot 0 is always assigned to it
+                        fieldTmps.front()->template computeValue<CORE + BORDER, Solver, Filter>(
+                            *speciesTmp,
+                            params->currentStep);
+                    }
+                    else
+                    {
+                        FieldTmp::computeValues<CORE + BORDER, BatchSolvers, Filter>(
+                            *speciesTmp,
+                            params->currentStep,
+                            slots);
+                    }
 
-                    EventTask fieldTmpEvent = fieldTmp->asyncCommunication(__getTransactionEvent());
+                    // start the exchange of all slots before waiting for any of them
+                    EventTask const serialEvent = __getTransactionEvent();
+                    EventTask fieldTmpEvent;
+                    for(auto& fieldTmp : fieldTmps)
+                        fieldTmpEvent += fieldTmp->asyncCommunication(serialEvent);
                     __setTransactionEvent(fieldTmpEvent);
                     /* copy data to host that we can write same to disk*/
-                    fieldTmp->getGridBuffer().deviceToHost();
+                    for(auto& fieldTmp : fieldTmps)
+                        fieldTmp->getGridBuffer().deviceToHost();
                     /*## finish update field ##*/
 
-                    const uint32_t components = GetNComponents<ValueType>::value;
-
-                    /*wrap in a one-component vector for writeField API*/
-                    const traits::FieldPosition<typename fields::CellType, FieldTmp> fieldPos;
-
-                    std::vector<std::vector<float_X>> inCellPosition;
-                    std::vector<float_X> inCellPositonComponent;
-                    for(uint32_t d = 0; d < simDim; ++d)
-                        inCellPositonComponent.push_back(fieldPos()[0][d]);
-                    inCellPosition.push_back(inCellPositonComponent);
-
-                    /** \todo check if always correct at this point, depends on
-                     * solver implementation */
-                    const float_X timeOffset = 0.0;
-
-                    params->gridLayout = fieldTmp->getGridLayout();
-                    bool const isDomainBound = traits::IsFieldDomainBound<FieldTmp>::value;
-                    /*write data to openPMD Series*/
-                    openPMDWriter::template writeField<ComponentType>(
-                        params,
-                        components,
-                        getName(),
-                        fieldTmp->getHostDataBox().getPointer(),
-                        getUnit(),
-                        FieldTmp::getUnitDimension<Solver>(),
-                        std::move(inCellPosition),
-                        timeOffset,
-                        isDomainBound);
+                    meta::ForEach<BatchOperations, WriteFieldTmpSlot<bmpl::_1>>{}(params, names, slots);
                 }
             };
 
@@ -628,6 +800,12 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 // getPointer() will wait for device->host transfer
                 ValueType* nativePtr = buffer.getHostBuffer().getPointer();
                 ReinterpretedType* rawPtr = reinterpret_cast<ReinterpretedType*>(nativePtr);
+                size_t const numBytes = fieldsSizeDims.productOfComponents();
+                if(params->skipUnchangedCheckpointData(name, hashMemory(rawPtr, numBytes)))
+                {
+                    params->openPMDSeries->flush();
+                    return;
+                }
                 mrc.storeChunk(
                     ::openPMD::shareRaw(rawPtr),
                     asStandardVector(fieldsOffsetDims),
@@ -651,7 +829,8 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 auto rngProvider = dc.get<RNGProvider>(RNGProvider::getName());
                 auto const name = rngProvider->getName();
 
-                ::openPMD::Iteration iteration = params->openPMDSeries->WRITE_ITERATIONS[params->currentStep];
+                ::openPMD::Iteration iteration
+                    = params->openPMDSeries->iterations[params->getCheckpointSource(name)];
                 ::openPMD::Mesh mesh = iteration.meshes[name];
                 ::openPMD::MeshRecordComponent mrc = mesh[::openPMD::RecordComponent::SCALAR];
 
@@ -706,6 +885,83 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 }
             }
 
+            /** Load the state of the particle id provider
+             *
+             * The state is stored per rank. If the checkpoint was written with another number of ranks,
+             * each rank continues the id sequence of the rank with the same scalar position in the checkpoint.
+             * Ranks without a counterpart in the checkpoint keep their initial state, their id range has not
+             * been used before.
+             */
+            HINLINE void loadIdProviderState(ThreadParams* params)
+            {
+                GridController<simDim>& gc = Environment<simDim>::get().GridController();
+                ::openPMD::Series& series = *params->openPMDSeries;
+                ::openPMD::Container<::openPMD::Mesh>& meshes = series.iterations[params->currentStep].meshes;
+                ::openPMD::MeshRecordComponent startIdRecord = meshes["picongpu_idProvider"]["startId"];
+                ::openPMD::MeshRecordComponent nextIdRecord = meshes["picongpu_idProvider"]["nextId"];
+
+                ::openPMD::Extent const extent = startIdRecord.getExtent();
+                if(extent.size() != simDim)
+                    throw std::runtime_error("Invalid dimensionality for picongpu/idProvider/startId");
+
+                DataSpace<simDim> checkpointGpuNodes;
+                for(uint32_t d = 0; d < simDim; ++d)
+                    checkpointGpuNodes[d] = static_cast<int>(extent[simDim - 1u - d]);
+
+                IdProvider<simDim>::State idProvState;
+                if(checkpointGpuNodes == gc.getGpuNodes())
+                {
+                    ReadNDScalars<uint64_t, uint64_t>()(
+                        *params,
+                        "picongpu",
+                        "idProvider",
+                        "startId",
+                        &idProvState.startId,
+                        "maxNumProc",
+                        &idProvState.maxNumProc);
+                    ReadNDScalars<uint64_t>()(*params, "picongpu", "idProvider", "nextId", &idProvState.nextId);
+                }
+                else
+                {
+                    // initial state of this rank
+                    idProvState = IdProvider<simDim>::getState();
+                    idProvState.maxNumProc = std::max(
+                        idProvState.maxNumProc,
+                        startIdRecord.getAttribute("maxNumProc").get<uint64_t>());
+
+                    auto const scalarPosition = static_cast<int>(gc.getScalarPosition());
+                    bool const hasCheckpointState = scalarPosition < checkpointGpuNodes.productOfComponents();
+
+                    std::shared_ptr<uint64_t> startId;
+                    std::shared_ptr<uint64_t> nextId;
+                    __getTransactionEvent().waitForFinished();
+                    if(hasCheckpointState)
+                    {
+                        DataSpace<simDim> const checkpointPosition
+                            = DataSpaceOperations<simDim>::map(checkpointGpuNodes, scalarPosition);
+                        ::openPMD::Offset start
+                            = asStandardVector<DataSpace<simDim>, ::openPMD::Offset>(checkpointPosition);
+                        ::openPMD::Extent count(simDim, 1u);
+                        startId = startIdRecord.loadChunk<uint64_t>(start, count);
+                        nextId = nextIdRecord.loadChunk<uint64_t>(start, count);
+                    }
+                    // flush is collective for some backends, all ranks must participate
+                    series.flush();
+
+                    if(hasCheckpointState)
+                    {
+                        idProvState.startId = *startId;
+                        idProvState.nextId = *nextId;
+                    }
+                    log<picLog::INPUT_OUTPUT>(
+                        "openPMD: domain decomposition differs from the checkpoint, continue ids of checkpoint "
+                        "rank: %1%")
+                        % hasCheckpointState;
+                }
+                log<picLog::INPUT_OUTPUT>("Setting next free id on current rank: %1%") % idProvState.nextId;
+                IdProvider<simDim>::setState(idProvState);
+            }
+
         public:
             /** constructor
              *
@@ -742,6 +998,8 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                         /** create notify directory */
                         Environment<simDim>::get().Filesystem().createDirectoryWithPermissions(outputDirectory);
                     }
+
+                    initAsyncWriter();
                 }
 
                 // avoid deadlock between not finished pmacc tasks and mpi blocking
@@ -753,6 +1011,17 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
             virtual ~openPMDWriter()
             {
+                if(asyncWriter)
+                {
+                    try
+                    {
+                        asyncWriter->waitForAll();
+                    }
+                    catch(std::exception const& e)
+                    {
+                        std::cerr << "openPMD: asynchronous write failed: " << e.what() << std::endl;
+                    }
+                }
                 if(mThreadParams.communicator != MPI_COMM_NULL)
                 {
                     // avoid deadlock between not finished pmacc tasks and mpi
@@ -775,6 +1044,8 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 /* window selection */
                 mThreadParams.window = MovingWindow::getInstance().getWindow(currentStep);
                 mThreadParams.isCheckpoint = false;
+                mThreadParams.isIncrementalCheckpoint = false;
+                mThreadParams.deferFlush = static_cast<bool>(asyncWriter);
                 dumpData(currentStep);
             }
 
@@ -795,7 +1066,8 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
             void dumpCheckpoint(
                 const uint32_t currentStep,
                 const std::string& checkpointDirectory,
-                const std::string& checkpointFilename)
+                const std::string& checkpointFilename,
+                bool const incremental)
             {
                 // checkpointing is only allowed if the plugin is controlled by the
                 // class Checkpoint
@@ -805,6 +1077,25 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 /* if file name is relative, prepend with common directory */
 
                 mThreadParams.isCheckpoint = true;
+                /* a slide of the moving window moves the data between the ranks,
+                 * the local data of an incremental checkpoint is only comparable within the same window
+                 */
+                uint32_t const slides = MovingWindow::getInstance().getSlideCounter(currentStep);
+                mThreadParams.isIncrementalCheckpoint = incremental && mThreadParams.hasFullCheckpoint
+                    && mThreadParams.fullCheckpointSlides == slides;
+                if(mThreadParams.isIncrementalCheckpoint)
+                {
+                    log<picLog::INPUT_OUTPUT>("openPMD: write incremental checkpoint based on step %1%")
+                        % mThreadParams.fullCheckpointStep;
+                }
+                else
+                {
+                    mThreadParams.hasFullCheckpoint = true;
+                    mThreadParams.fullCheckpointStep = currentStep;
+                    mThreadParams.fullCheckpointSlides = slides;
+                    mThreadParams.fullCheckpointHashes.clear();
+                }
+                mThreadParams.deferFlush = false;
                 mThreadParams.initFromConfig(*m_help, m_id, checkpointFilename, checkpointDirectory);
 
                 mThreadParams.window = MovingWindow::getInstance().getDomainAsWindow(currentStep);
@@ -812,6 +1103,12 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 dumpData(currentStep);
             }
 
+            //! ADIOS2 writes separate subfiles per aggregator, other backends (e.g. HDF5) one file for all ranks
+            bool isNodeLocalCheckpointMergeable() const override
+            {
+                return m_help->fileNameExtension.get(m_id) == "bp";
+            }
+
             void doRestart(
                 const uint32_t restartStep,
                 const std::string& restartDirectory,
@@ -844,6 +1141,21 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
                 PMACC_ASSERT(lastStep == restartStep);
 
+                if(iteration.containsAttribute("fullCheckpointStep"))
+                {
+                    uint32_t const fullStep = iteration.getAttribute("fullCheckpointStep").get<uint32_t>();
+                    log<picLog::INPUT_OUTPUT>(
+                        "openPMD: incremental checkpoint, unchanged data is loaded from step %1%")
+                        % fullStep;
+                    /* open the full checkpoint on all ranks together,
+                     * afterwards each rank loads its data from the checkpoint holding it
+                     */
+                    ::openPMD::Iteration fullIteration = mThreadParams.openPMDSeries->iterations[fullStep];
+                    if(fullIteration.getAttribute("sim_slides").get<uint32_t>() != slides)
+                        throw std::runtime_error("openPMD: moving window of the incremental checkpoint and its full "
+                                                 "checkpoint differ");
+                }
+
                 /* apply slides to set gpus to last/written configuration */
                 log<picLog::INPUT_OUTPUT>("openPMD: Setting slide count for moving window to %1%") % slides;
                 MovingWindow::getInstance().setSlideCounter(slides, restartStep);
@@ -871,18 +1183,7 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
                 loadRngStates(&mThreadParams);
 
-                IdProvider<simDim>::State idProvState;
-                ReadNDScalars<uint64_t, uint64_t>()(
-                    mThreadParams,
-                    "picongpu",
-                    "idProvider",
-                    "startId",
-                    &idProvState.startId,
-                    "maxNumProc",
-                    &idProvState.maxNumProc);
-                ReadNDScalars<uint64_t>()(mThreadParams, "picongpu", "idProvider", "nextId", &idProvState.nextId);
-                log<picLog::INPUT_OUTPUT>("Setting next free id on current rank: %1%") % idProvState.nextId;
-                IdProvider<simDim>::setState(idProvState);
+                loadIdProviderState(&mThreadParams);
 
                 // avoid deadlock between not finished pmacc tasks and mpi calls in
                 // openPMD
@@ -893,6 +1194,47 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
             }
 
         private:
+            /** create the background writer if asynchronous output is requested and supported
+             *
+             * Falls back to synchronous output if the backend is not ADIOS2 (parallel HDF5 is not thread-safe),
+             * the iteration layout is not file-based (the Series would be shared between iterations) or MPI does
+             * not allow collectives from a second thread.
+             */
+            void initAsyncWriter()
+            {
+                uint32_t const maxInFlight = m_help->asyncWrites.get(m_id);
+                if(maxInFlight == 0u)
+                    return;
+
+                std::string const infix = m_help->fileNameInfix.get(m_id);
+                std::string const extension = m_help->fileNameExtension.get(m_id);
+                bool const isFileBased
+                    = infix != "NULL" && extension != "sst" && infix.find('%') != std::string::npos;
+
+                int threadLevel = MPI_THREAD_SINGLE;
+                MPI_CHECK(MPI_Query_thread(&threadLevel));
+
+                if(extension != "bp")
+                {
+                    log<picLog::INPUT_OUTPUT>("openPMD: asyncWrites requires the ADIOS2 backend (ext=bp), "
+                                              "writing synchronously");
+                }
+                else if(!isFileBased)
+                {
+                    log<picLog::INPUT_OUTPUT>("openPMD: asyncWrites requires a file-based iteration layout, "
+                                              "writing synchronously");
+                }
+                else if(threadLevel < MPI_THREAD_MULTIPLE)
+                {
+                    log<picLog::INPUT_OUTPUT>("openPMD: asyncWrites requires MPI_THREAD_MULTIPLE (build with "
+                                              "PMACC_MPI_THREAD_MULTIPLE=ON), writing synchronously");
+                }
+                else
+                {
+                    asyncWriter = std::make_unique<AsyncWriter>(maxInFlight);
+                }
+            }
+
             void endWrite()
             {
                 mThreadParams.fieldBuffer.resize(0);
@@ -1117,6 +1459,12 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                     }
                     log<picLog::INPUT_OUTPUT>("openPMD:  (end) collect PML sizes for %1%") % name;
 
+                    // store the layout to detect a changed domain decomposition on restart
+                    std::vector<uint64_t> sizesPerDomain(numRanks);
+                    for(uint64_t r = 0; r < numRanks; ++r)
+                        sizesPerDomain.at(localSizes.at(2u * r + 1u)) = localSizes.at(2u * r);
+                    mesh.setAttribute("localSizesPerDomain", sizesPerDomain);
+
                     fieldsGlobalSizeDims = pmacc::math::UInt64<simDim>::create(1);
                     fieldsGlobalSizeDims[0] = globalSize;
                     fieldsOffsetDims = pmacc::math::UInt64<simDim>::create(0);
@@ -1125,6 +1473,11 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
                 auto const componentSize = field_no_guard.productOfComponents();
 
+                // checkpoints omit local data which did not change since the last full checkpoint
+                size_t const fieldBytes = field_full.productOfComponents() * nComponents * sizeof(ComponentType);
+                uint64_t const fieldHash = params->isCheckpoint ? hashMemory(ptr, fieldBytes) : 0u;
+                bool const isUnchanged = params->skipUnchangedCheckpointData(name, fieldHash);
+
                 /* write the actual field data */
                 for(uint32_t d = 0; d < nComponents; d++)
                 {
@@ -1134,66 +1487,90 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                         ? params->openPMDSeries->meshesPath() + name + "/" + name_lookup_tpl[d]
                         : params->openPMDSeries->meshesPath() + name;
 
-                    params->initDataset<simDim>(mrc, openPMDType, fieldsGlobalSizeDims, datasetName);
+                    auto const precision = params->getPrecision(datasetName);
+                    bool const storeFloat32 = precision.float32 && std::is_same<ComponentType, float_64>::value;
+                    params->initDataset<simDim>(
+                        mrc,
+                        storeFloat32 ? ::openPMD::Datatype::FLOAT : openPMDType,
+                        fieldsGlobalSizeDims,
+                        datasetName);
 
                     // define record component level attributes
                     mrc.setPosition(inCellPosition.at(d));
                     mrc.setUnitSI(unit.at(d));
 
-                    if(componentSize == 0)
+                    if(componentSize == 0 || isUnchanged)
                     {
                         // technically not necessary if we write no dataset,
                         // but let's keep things uniform
-                        params->openPMDSeries->flush();
+                        params->flush();
                         continue;
                     }
 
-                    // ask openPMD to create a buffer for us
-                    // in some backends (ADIOS2), this allows avoiding memcopies
-                    auto span = storeChunkSpan<ComponentType>(
-                        mrc,
-                        asStandardVector(fieldsOffsetDims),
-                        asStandardVector(fieldsSizeDims),
-                        [&fieldBuffer](size_t size) {
-                            // if there is no special backend support for creating buffers,
-                            // reuse the fieldBuffer
-                            fieldBuffer.resize(sizeof(ComponentType) * size);
-                            return std::shared_ptr<ComponentType>{
-                                reinterpret_cast<ComponentType*>(fieldBuffer.data()),
-                                [](auto*) {}};
-                        });
-                    auto dstBuffer = span.currentBuffer();
-
-                    const size_t plane_full_size = field_full[1] * field_full[0] * nComponents;
-                    const size_t plane_no_guard_size = field_no_guard[1] * field_no_guard[0];
-
-                    /* copy strided data from source to temporary buffer
-                     *
-                     * \todo use d1Access as in
-                     * `include/plugins/hdf5/writer/Field.hpp`
-                     */
-                    const int maxZ = simDim == DIM3 ? field_no_guard[2] : 1;
-                    const int guardZ = simDim == DIM3 ? field_guard[2] : 0;
-                    for(int z = 0; z < maxZ; ++z)
-                    {
-                        for(int y = 0; y < field_no_guard[1]; ++y)
+                    auto storeComponent = [&](auto storeTypeTag) {
+                        using StoreType = typename decltype(storeTypeTag)::type;
+
+                        // ask openPMD to create a buffer for us
+                        // in some backends (ADIOS2), this allows avoiding memcopies
+                        auto span = storeChunkSpan<StoreType>(
+                            mrc,
+                            asStandardVector(fieldsOffsetDims),
+                            asStandardVector(fieldsSizeDims),
+                            [&fieldBuffer, params](size_t size) {
+                                // deferred flushes need one buffer per component, owned by the Series
+                                if(params->deferFlush)
+                                {
+                                    return std::shared_ptr<StoreType>{
+                                        new StoreType[size],
+                                        [](StoreType* ptr) { delete[] ptr; }};
+                                }
+                                // if there is no special backend support for creating buffers,
+                                // reuse the fieldBuffer
+                                fieldBuffer.resize(sizeof(StoreType) * size);
+                                return std::shared_ptr<StoreType>{
+                                    reinterpret_cast<StoreType*>(fieldBuffer.data()),
+                                    [](auto*) {}};
+                            });
+                        auto dstBuffer = span.currentBuffer();
+
+                        const size_t plane_full_size = field_full[1] * field_full[0] * nComponents;
+                        const size_t plane_no_guard_size = field_no_guard[1] * field_no_guard[0];
+
+                        /* copy strided data from source to temporary buffer
+                         *
+                         * \todo use d1Access as in
+                         * `include/plugins/hdf5/writer/Field.hpp`
+                         */
+                        const int maxZ = simDim == DIM3 ? field_no_guard[2] : 1;
+                        const int guardZ = simDim == DIM3 ? field_guard[2] : 0;
+                        for(int z = 0; z < maxZ; ++z)
                         {
-                            const size_t base_index_src
-                                = (z + guardZ) * plane_full_size + (y + field_guard[1]) * field_full[0] * nComponents;
+                            for(int y = 0; y < field_no_guard[1]; ++y)
+                            {
+                                const size_t base_index_src = (z + guardZ) * plane_full_size
+                                    + (y + field_guard[1]) * field_full[0] * nComponents;
 
-                            const size_t base_index_dst = z * plane_no_guard_size + y * field_no_guard[0];
+                                const size_t base_index_dst = z * plane_no_guard_size + y * field_no_guard[0];
 
-                            for(int x = 0; x < field_no_guard[0]; ++x)
-                            {
-                                size_t index_src = base_index_src + (x + field_guard[0]) * nComponents + d;
-                                size_t index_dst = base_index_dst + x;
+                                for(int x = 0; x < field_no_guard[0]; ++x)
+                                {
+                                    size_t index_src = base_index_src + (x + field_guard[0]) * nComponents + d;
+                                    size_t index_dst = base_index_dst + x;
 
-                                dstBuffer[index_dst] = reinterpret_cast<ComponentType*>(ptr)[index_src];
+                                    dstBuffer[index_dst] = roundMantissa(
+                                        static_cast<StoreType>(reinterpret_cast<ComponentType*>(ptr)[index_src]),
+                                        precision.mantissaBits);
+                                }
                             }
                         }
-                    }
+                    };
 
-                    params->openPMDSeries->flush();
+                    if(storeFloat32)
+                        storeComponent(bmpl::identity<float_32>{});
+                    else
+                        storeComponent(bmpl::identity<ComponentType>{});
+
+                    params->flush();
                 }
             }
 
@@ -1269,17 +1646,46 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
 
                 bool dumpFields = plugins::misc::containsObject(vectorOfDataSourceNames, "fields_all");
 
+                threadParams->requestedFields.clear();
+                threadParams->writtenFieldTmpOperations.clear();
+                if(!threadParams->isCheckpoint)
+                {
+                    std::vector<std::string> fieldNames;
+                    meta::ForEach<FileOutputFields, plugins::misc::AppendName<bmpl::_1>>{}(fieldNames);
+                    for(auto const& fieldName : fieldNames)
+                        if(dumpFields || plugins::misc::containsObject(vectorOfDataSourceNames, fieldName))
+                            threadParams->requestedFields.insert(fieldName);
+                }
+
                 if(threadParams->openPMDSeries)
                 {
                     log<picLog::INPUT_OUTPUT>("openPMD: Series still open, reusing");
                     // TODO check for same configuration
                 }
+                else if(threadParams->deferFlush)
+                {
+                    /* each Series written in the background gets its own communicator, collectives of
+                     * concurrently finalized iterations can not interfere
+                     */
+                    __getTransactionEvent().waitForFinished();
+                    MPI_CHECK(MPI_Comm_dup(threadParams->communicator, &asyncCommunicator));
+                    log<picLog::INPUT_OUTPUT>("openPMD: opening Series %1%") % threadParams->fileName;
+                    threadParams->openSeries(::openPMD::Access::CREATE, asyncCommunicator);
+                }
                 else
                 {
                     log<picLog::INPUT_OUTPUT>("openPMD: opening Series %1%") % threadParams->fileName;
                     threadParams->openSeries(::openPMD::Access::CREATE);
                 }
 
+                if(threadParams->isIncrementalCheckpoint)
+                {
+                    // a restart loads the data not contained in this checkpoint from the full checkpoint
+                    threadParams->openPMDSeries->WRITE_ITERATIONS[threadParams->currentStep].setAttribute(
+                        "fullCheckpointStep",
+                        threadParams->fullCheckpointStep);
+                }
+
                 bool dumpAllParticles = plugins::misc::containsObject(vectorOfDataSourceNames, "species_all");
 
                 /* write fields */
@@ -1368,13 +1774,31 @@ make sure that environment variable OPENPMD_BP_BACKEND is not set to ADIOS1.
                 // avoid deadlock between not finished pmacc tasks and mpi calls in
                 // openPMD
                 __getTransactionEvent().waitForFinished();
-                mThreadParams.openPMDSeries->WRITE_ITERATIONS[mThreadParams.currentStep].close();
+                if(threadParams->deferFlush)
+                {
+                    log<picLog::INPUT_OUTPUT>("openPMD: flush iteration %1% in the background (%2% in flight)")
+                        % threadParams->currentStep % asyncWriter->getNumInFlight();
+                    asyncWriter->submit(
+                        std::move(threadParams->openPMDSeries),
+                        asyncCommunicator,
+                        threadParams->currentStep);
+                    asyncCommunicator = MPI_COMM_NULL;
+                }
+                else
+                {
+                    mThreadParams.openPMDSeries->WRITE_ITERATIONS[mThreadParams.currentStep].close();
+                }
 
                 return;
             }
 
             ThreadParams mThreadParams;
 
+            //! background writer, null if output is written synchronously
+            std::unique_ptr<AsyncWriter> asyncWriter;
+            //! communicator of the Series currently prepared for the background writer
+            MPI_Comm asyncCommunicator = MPI_COMM_NULL;
+
             std::shared_ptr<Help> m_help;
             size_t m_id;
 
@@ -33,6 +33,8 @@
 #include <pmacc/traits/Resolve.hpp>
 
 #include <memory>
+#include <numeric>
+#include <vector>
 
 #include <openPMD/openPMD.hpp>
 
@@ -50,21 +52,23 @@ namespace picongpu
         struct LoadParticleAttributesFromOpenPMD
         {
             /** read attributes from openPMD file
+             *
+             * The particles are read from one or more contiguous chunks of the attribute array.
+             * The chunks are stored back to back in the frame.
              *
              * @param params thread params
              * @param frame frame with all particles
              * @param particleSpecies the openpmd representation of the species
-             * @param particlesOffset read offset in the attribute array
-             * @param elements number of elements which should be read the attribute
-             * array
+             * @param chunkOffsets read offset of each chunk in the attribute array
+             * @param chunkSizes number of elements which should be read from the attribute array for each chunk
              */
             template<typename FrameType>
             HINLINE void operator()(
                 ThreadParams* params,
                 FrameType& frame,
                 ::openPMD::ParticleSpecies particleSpecies,
-                const uint64_t particlesOffset,
-                const uint64_t elements)
+                std::vector<uint64_t> const& chunkOffsets,
+                std::vector<uint64_t> const& chunkSizes)
             {
                 using Identifier = T_Identifier;
                 using ValueType = typename pmacc::traits::Resolve<Identifier>::type::type;
@@ -76,6 +80,8 @@ namespace picongpu
 
                 const std::string name_lookup[] = {"x", "y", "z"};
 
+                uint64_t const elements = std::accumulate(chunkSizes.begin(), chunkSizes.end(), uint64_t(0u));
+
                 std::shared_ptr<ComponentType> loadBfr;
                 if(elements > 0)
                 {
@@ -97,10 +103,18 @@ namespace picongpu
                         // avoid deadlock between not finished pmacc tasks and mpi
                         // calls in openPMD
                         __getTransactionEvent().waitForFinished();
-                        rc.loadChunk<ComponentType>(
-                            loadBfr,
-                            ::openPMD::Offset{particlesOffset},
-                            ::openPMD::Extent{elements});
+                        uint64_t bufferOffset = 0u;
+                        for(size_t c = 0u; c < chunkOffsets.size(); ++c)
+                        {
+                            if(chunkSizes[c] == 0u)
+                                continue;
+                            // aliasing constructor: share the ownership of the buffer but point to the chunk
+                            rc.loadChunk<ComponentType>(
+                                std::shared_ptr<ComponentType>{loadBfr, loadBfr.get() + bufferOffset},
+                                ::openPMD::Offset{chunkOffsets[c]},
+                                ::openPMD::Extent{chunkSizes[c]});
+                            bufferOffset += chunkSizes[c];
+                        }
                     }
 
                     /** start a blocking read of all scheduled variables
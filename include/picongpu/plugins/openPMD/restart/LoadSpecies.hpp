@@ -39,8 +39,11 @@
 #include <boost/mpl/size.hpp>
 #include <boost/mpl/vector.hpp>
 
+#include <algorithm>
 #include <cassert>
+#include <memory>
 #include <stdexcept>
+#include <vector>
 
 #include <openPMD/openPMD.hpp>
 
@@ -50,6 +53,21 @@ namespace picongpu
     {
         using namespace pmacc;
 
+        /** move the particle attributes from one frame slot to another
+         *
+         * @tparam T_Identifier identifier of species attribute
+         */
+        template<typename T_Identifier>
+        struct MoveParticleAttribute
+        {
+            template<typename T_Frame>
+            HINLINE void operator()(T_Frame& frame, uint64_t const destIdx, uint64_t const srcIdx) const
+            {
+                auto* ptr = frame.getIdentifier(T_Identifier()).getPointer();
+                ptr[destIdx] = ptr[srcIdx];
+            }
+        };
+
         /** Load species from openPMD checkpoint storage
          *
          * @tparam T_Species type of species
@@ -87,11 +105,11 @@ namespace picongpu
                 std::string const speciesName = FrameType::getName();
                 log<picLog::INPUT_OUTPUT>("openPMD: (begin) load species: %1%") % speciesName;
                 DataConnector& dc = Environment<>::get().DataConnector();
-                GridController<simDim>& gc = Environment<simDim>::get().GridController();
 
                 ::openPMD::Series& series = *params->openPMDSeries;
+                // unchanged local particles of an incremental checkpoint are stored in the full checkpoint
                 ::openPMD::Container<::openPMD::ParticleSpecies>& particles
-                    = series.iterations[params->currentStep].particles;
+                    = series.iterations[params->getCheckpointSource("particles_" + speciesName)].particles;
                 ::openPMD::ParticleSpecies particleSpecies = particles[speciesName];
 
                 const pmacc::Selection<simDim> localDomain = Environment<simDim>::get().SubGrid().getLocalDomain();
@@ -103,35 +121,40 @@ namespace picongpu
                 // openPMD
                 __getTransactionEvent().waitForFinished();
 
-                auto numRanks = gc.getGlobalSize();
+                ::openPMD::PatchRecordComponent patchNumParticles
+                    = particleSpecies.particlePatches["numParticles"][::openPMD::RecordComponent::SCALAR];
+                // the number of patches is the number of ranks used to write the checkpoint
+                size_t const numPatches = patchNumParticles.getExtent().at(0);
 
-                size_t patchIdx = getPatchIdx(params, series, particleSpecies, numRanks);
+                bool isPatchMatchingDomain = false;
+                std::vector<size_t> const patchIndices
+                    = getPatchIndices(params, series, particleSpecies, numPatches, isPatchMatchingDomain);
 
-                std::shared_ptr<uint64_t> fullParticlesInfoShared
-                    = particleSpecies.particlePatches["numParticles"][::openPMD::RecordComponent::SCALAR]
-                          .load<uint64_t>();
+                std::shared_ptr<uint64_t> fullParticlesInfoShared = patchNumParticles.load<uint64_t>();
                 series.flush();
                 uint64_t* fullParticlesInfo = fullParticlesInfoShared.get();
 
                 /* Run a prefix sum over the numParticles[0] element in
                  * particlesInfo to retreive the offset of particles
                  */
-                uint64_t particleOffset = 0u;
+                std::vector<uint64_t> particleOffsets(numPatches, 0u);
+                for(size_t i = 1u; i < numPatches; ++i)
+                    particleOffsets[i] = particleOffsets[i - 1u] + fullParticlesInfo[i - 1u];
+
+                std::vector<uint64_t> chunkOffsets;
+                std::vector<uint64_t> chunkSizes;
                 /* count total number of particles on the device */
                 uint64_t totalNumParticles = 0u;
-
-                assert(patchIdx < numRanks);
-
-                for(size_t i = 0u; i <= patchIdx; ++i)
+                for(auto const patchIdx : patchIndices)
                 {
-                    if(i < patchIdx)
-                        particleOffset += fullParticlesInfo[i];
-                    if(i == patchIdx)
-                        totalNumParticles = fullParticlesInfo[i];
-                }
+                    chunkOffsets.push_back(particleOffsets[patchIdx]);
+                    chunkSizes.push_back(fullParticlesInfo[patchIdx]);
+                    totalNumParticles += fullParticlesInfo[patchIdx];
 
-                log<picLog::INPUT_OUTPUT>("openPMD: Loading %1% particles from offset %2%")
-                    % (long long unsigned) totalNumParticles % (long long unsigned) particleOffset;
+                    log<picLog::INPUT_OUTPUT>("openPMD: Loading %1% particles from offset %2%")
+                        % (long long unsigned) fullParticlesInfo[patchIdx]
+                        % (long long unsigned) particleOffsets[patchIdx];
+                }
 
                 openPMDFrameType hostFrame;
                 log<picLog::INPUT_OUTPUT>("openPMD: malloc mapped memory: %1%") % speciesName;
@@ -147,7 +170,18 @@ namespace picongpu
 
                 meta::ForEach<typename openPMDFrameType::ValueTypeSeq, LoadParticleAttributesFromOpenPMD<bmpl::_1>>
                     loadAttributes;
-                loadAttributes(params, hostFrame, particleSpecies, particleOffset, totalNumParticles);
+                loadAttributes(params, hostFrame, particleSpecies, chunkOffsets, chunkSizes);
+
+                uint64_t const numLoadedParticles = totalNumParticles;
+                if(!isPatchMatchingDomain)
+                {
+                    /* the checkpoint was written with a different domain decomposition,
+                     * keep only particles within the local domain
+                     */
+                    totalNumParticles = removeParticlesOutsideDomain(hostFrame, numLoadedParticles, localDomain);
+                    log<picLog::INPUT_OUTPUT>("openPMD: Keep %1% of %2% particles loaded from overlapping patches")
+                        % (long long unsigned) totalNumParticles % (long long unsigned) numLoadedParticles;
+                }
 
                 if(totalNumParticles != 0)
                 {
@@ -160,7 +194,10 @@ namespace picongpu
                         totalCellIdx_,
                         *(params->cellDescription),
                         picLog::INPUT_OUTPUT());
+                }
 
+                if(numLoadedParticles != 0)
+                {
                     /*free host memory*/
                     meta::ForEach<typename openPMDFrameType::ValueTypeSeq, FreeMemory<bmpl::_1>> freeMem;
                     freeMem(hostFrame);
@@ -169,27 +206,31 @@ namespace picongpu
             }
 
         private:
-            /** get index for particle data within the openPMD patch data
+            /** get indices of all particle patches overlapping the local domain
              *
              * It is not possible to assume that we can use the MPI rank to load the particle data.
              * There is no guarantee that the MPI rank is corresponding to the position within
              * the simulation volume.
+             * Additionally, the checkpoint can be written with a different number of ranks or a different
+             * domain decomposition.
              *
-             * Use patch information offset and extent to find the index which should be used
-             * to load openPMD particle patch data.
+             * Use patch information offset and extent to find all patches overlapping the local domain.
              *
-             * @return index of the particle patch within the openPMD data
+             * @param numPatches number of particle patches in the openPMD data
+             * @param[out] isPatchMatchingDomain true if exactly one patch matches the local domain
+             * @return indices of the particle patches within the openPMD data
              */
-            HINLINE size_t getPatchIdx(
+            HINLINE std::vector<size_t> getPatchIndices(
                 ThreadParams* params,
                 ::openPMD::Series& series,
                 ::openPMD::ParticleSpecies particleSpecies,
-                size_t numRanks)
+                size_t numPatches,
+                bool& isPatchMatchingDomain)
             {
                 const std::string name_lookup[] = {"x", "y", "z"};
 
-                std::vector<DataSpace<simDim>> offsets(numRanks);
-                std::vector<DataSpace<simDim>> extents(numRanks);
+                std::vector<DataSpace<simDim>> offsets(numPatches);
+                std::vector<DataSpace<simDim>> extents(numPatches);
 
                 // transform openPMD particle patch data into PIConGPU data objects
                 for(uint32_t d = 0; d < simDim; ++d)
@@ -199,7 +240,7 @@ namespace picongpu
                     std::shared_ptr<uint64_t> patchExtentsInfoShared
                         = particleSpecies.particlePatches["extent"][name_lookup[d]].load<uint64_t>();
                     series.flush();
-                    for(size_t i = 0; i < numRanks; ++i)
+                    for(size_t i = 0; i < numPatches; ++i)
                     {
                         offsets[i][d] = patchOffsetsInfoShared.get()[i];
                         extents[i][d] = patchExtentsInfoShared.get()[i];
@@ -211,17 +252,68 @@ namespace picongpu
                     = params->window.globalDimensions.offset + params->window.localDimensions.offset;
                 DataSpace<simDim> const patchExtent = params->window.localDimensions.size;
 
-                // search the patch index based on the offset and extents of local domain size
-                for(size_t i = 0; i < numRanks; ++i)
+                // fast path: the checkpoint was written with the same domain decomposition
+                for(size_t i = 0; i < numPatches; ++i)
                 {
                     if(patchOffset == offsets[i] && patchExtent == extents[i])
-                        return i;
+                    {
+                        isPatchMatchingDomain = true;
+                        return {i};
+                    }
+                }
+
+                isPatchMatchingDomain = false;
+                std::vector<size_t> patchIndices;
+                for(size_t i = 0; i < numPatches; ++i)
+                {
+                    bool isOverlapping = true;
+                    for(uint32_t d = 0; d < simDim; ++d)
+                    {
+                        int const begin = std::max(patchOffset[d], offsets[i][d]);
+                        int const end = std::min(patchOffset[d] + patchExtent[d], offsets[i][d] + extents[i][d]);
+                        isOverlapping = isOverlapping && begin < end;
+                    }
+                    if(isOverlapping)
+                        patchIndices.push_back(i);
+                }
+                log<picLog::INPUT_OUTPUT>(
+                    "openPMD: domain decomposition differs from the checkpoint, load %1% overlapping patches")
+                    % patchIndices.size();
+                return patchIndices;
+            }
+
+            /** compact the frame to the particles located in the local domain
+             *
+             * @param frame host frame with all loaded particles
+             * @param numParticles number of particles in the frame
+             * @param localDomain local domain, offset is given in the same coordinate system as totalCellIdx
+             * @return number of particles in the frame after the compaction
+             */
+            HINLINE uint64_t removeParticlesOutsideDomain(
+                openPMDFrameType& frame,
+                uint64_t const numParticles,
+                pmacc::Selection<simDim> const& localDomain) const
+            {
+                auto const* totalCellIdxPtr = frame.getIdentifier(totalCellIdx_).getPointer();
+                meta::ForEach<typename openPMDFrameType::ValueTypeSeq, MoveParticleAttribute<bmpl::_1>>
+                    moveAttributes;
+
+                uint64_t numKeptParticles = 0u;
+                for(uint64_t i = 0u; i < numParticles; ++i)
+                {
+                    DataSpace<simDim> const cellIdx = totalCellIdxPtr[i] - localDomain.offset;
+                    bool isInside = true;
+                    for(uint32_t d = 0; d < simDim; ++d)
+                        isInside = isInside && cellIdx[d] >= 0 && cellIdx[d] < localDomain.size[d];
+
+                    if(isInside)
+                    {
+                        if(numKeptParticles != i)
+                            moveAttributes(frame, numKeptParticles, i);
+                        ++numKeptParticles;
+                    }
                 }
-                // If no patch fits the conditions, something went wrong before
-                throw std::runtime_error(
-                    "Error while restarting: no particle patch matches the required offset and extent");
-                // Fake return still needed to avoid warnings
-                return 0;
+                return numKeptParticles;
             }
         };
 
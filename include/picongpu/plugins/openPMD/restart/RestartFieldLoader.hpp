@@ -36,9 +36,11 @@
 #include <pmacc/particles/frame_types.hpp>
 #include <pmacc/types.hpp>
 
+#include <iostream>
 #include <sstream>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 #include <openPMD/openPMD.hpp>
 
@@ -76,6 +78,11 @@ namespace picongpu
                 DataSpace<simDim> local_domain_size = params->window.localDimensions.size;
                 bool useLinearIdxAsDestination = false;
 
+                ::openPMD::Series& series = *params->openPMDSeries;
+                // unchanged local data of an incremental checkpoint is stored in the full checkpoint
+                ::openPMD::Container<::openPMD::Mesh>& meshes
+                    = series.iterations[params->getCheckpointSource(objectName)].meshes;
+
                 /* Patch for non-domain-bound fields
                  * This is an ugly fix to allow output of reduced 1d PML buffers
                  */
@@ -114,6 +121,39 @@ namespace picongpu
                     }
                     log<picLog::INPUT_OUTPUT>("openPMD:  (end) collect PML sizes for %1%") % objectName;
 
+                    /* The buffer layout depends on the domain decomposition.
+                     * If the checkpoint was written with another decomposition the data can not be mapped,
+                     * the field keeps its initial (zero) state.
+                     */
+                    std::vector<uint64_t> sizesPerDomain(numRanks);
+                    for(uint64_t r = 0; r < numRanks; ++r)
+                        sizesPerDomain.at(localSizes.at(2u * r + 1u)) = localSizes.at(2u * r);
+
+                    /* Checkpoints written before the layout was stored can not be validated, the sum of the
+                     * local sizes does not depend on the decomposition. Such fields are loaded like before
+                     * under the assumption that the decomposition is unchanged.
+                     */
+                    bool isLayoutMatching = true;
+                    ::openPMD::Mesh mesh = meshes[objectName];
+                    if(mesh.containsAttribute("localSizesPerDomain"))
+                        isLayoutMatching
+                            = mesh.getAttribute("localSizesPerDomain").get<std::vector<uint64_t>>() == sizesPerDomain;
+                    else if(rank == 0u)
+                        std::cerr << "[openPMD] Warning: field '" << objectName
+                                  << "' has no domain decomposition information, it is loaded assuming the "
+                                     "decomposition of the checkpoint is unchanged"
+                                  << std::endl;
+
+                    if(!isLayoutMatching)
+                    {
+                        log<picLog::INPUT_OUTPUT>(
+                            "openPMD: domain decomposition differs from the checkpoint, field '%1%' is not loaded")
+                            % objectName;
+                        field.hostToDevice();
+                        __getTransactionEvent().waitForFinished();
+                        return;
+                    }
+
                     domain_offset = DataSpace<simDim>::create(0);
                     domain_offset[0] = static_cast<int>(domainOffset);
                     local_domain_size = DataSpace<simDim>::create(1);
@@ -121,9 +161,6 @@ namespace picongpu
                     useLinearIdxAsDestination = true;
                 }
 
-                ::openPMD::Series& series = *params->openPMDSeries;
-                ::openPMD::Container<::openPMD::Mesh>& meshes = series.iterations[params->currentStep].meshes;
-
                 auto destBox = field.getHostBuffer().getDataBox();
                 for(uint32_t n = 0; n < numComponents; ++n)
                 {
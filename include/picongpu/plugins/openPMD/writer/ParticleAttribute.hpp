@@ -23,6 +23,7 @@
 #include "picongpu/simulation_defines.hpp"
 
 #include "picongpu/plugins/openPMD/GetComponentsType.hpp"
+#include "picongpu/plugins/openPMD/OutputPrecision.hpp"
 #include "picongpu/plugins/openPMD/openPMDDimension.hpp"
 #include "picongpu/plugins/openPMD/openPMDWriter.def"
 #include "picongpu/traits/PICToOpenPMD.tpp"
@@ -31,6 +32,14 @@
 #include <pmacc/traits/GetNComponents.hpp>
 #include <pmacc/traits/Resolve.hpp>
 
+#include <boost/mpl/identity.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
 namespace picongpu
 {
     namespace openPMD
@@ -86,7 +95,8 @@ namespace picongpu
 
                 log<picLog::INPUT_OUTPUT>("openPMD:  (begin) write species attribute: %1%") % Identifier::getName();
 
-                std::shared_ptr<ComponentType> storeBfr;
+                // raw memory reused for all components, the stored type depends on the precision of the component
+                std::shared_ptr<char> storeBfr;
 
                 for(uint32_t d = 0; d < components; d++)
                 {
@@ -94,49 +104,98 @@ namespace picongpu
                         = components > 1 ? record[name_lookup[d]] : record[::openPMD::MeshRecordComponent::SCALAR];
 
                     std::string datasetName = components > 1 ? baseName + "/" + name_lookup[d] : baseName;
-                    params->initDataset<DIM1>(recordComponent, openPMDType, {globalElements}, datasetName);
+
+                    auto const precision = params->getPrecision(datasetName);
+                    // only the in-cell position is within [0;1)
+                    uint32_t const positionBits
+                        = std::is_floating_point<ComponentType>::value && openPMDName() == "position"
+                        ? precision.positionBits
+                        : 0u;
+                    bool const storeFloat32 = precision.float32 && std::is_same<ComponentType, float_64>::value;
+                    ::openPMD::Datatype datasetType = openPMDType;
+                    if(positionBits > 16u)
+                        datasetType = ::openPMD::Datatype::UINT;
+                    else if(positionBits > 0u)
+                        datasetType = ::openPMD::Datatype::USHORT;
+                    else if(storeFloat32)
+                        datasetType = ::openPMD::Datatype::FLOAT;
+
+                    params->initDataset<DIM1>(recordComponent, datasetType, {globalElements}, datasetName);
 
                     if(unit.size() >= (d + 1))
                     {
-                        recordComponent.setUnitSI(unit[d]);
+                        // a quantized position q is stored for the position q * 2^-positionBits
+                        recordComponent.setUnitSI(unit[d] * std::ldexp(1.0, -static_cast<int>(positionBits)));
                     }
 
                     if(elements == 0)
                     {
                         // technically not necessary if we write no dataset,
                         // but let's keep things uniform
-                        params->openPMDSeries->flush();
+                        params->flush();
                         continue;
                     }
 
                     ValueType* dataPtr = frame.getIdentifier(Identifier()).getPointer(); // can be moved up?
-                    // ask openPMD to create a buffer for us
-                    // in some backends (ADIOS2), this allows avoiding memcopies
-                    auto span = storeChunkSpan<ComponentType>(
-                                    recordComponent,
-                                    ::openPMD::Offset{globalOffset},
-                                    ::openPMD::Extent{elements},
-                                    [&storeBfr](size_t size) {
-                                        // if there is no special backend support for creating buffers,
-                                        // reuse the storeBfr
-                                        if(!storeBfr && size > 0)
-                                        {
-                                            storeBfr = std::shared_ptr<ComponentType>{
-                                                new ComponentType[size],
-                                                [](ComponentType* ptr) { delete[] ptr; }};
-                                        }
-                                        return storeBfr;
-                                    })
-                                    .currentBuffer();
-
-/* copy strided data from source to temporary buffer */
+                    ComponentType const* srcPtr = reinterpret_cast<ComponentType*>(dataPtr);
+
+                    auto storeComponent = [&](auto storeTypeTag) {
+                        using StoreType = typename decltype(storeTypeTag)::type;
+
+                        // ask openPMD to create a buffer for us
+                        // in some backends (ADIOS2), this allows avoiding memcopies
+                        auto span = storeChunkSpan<StoreType>(
+                                        recordComponent,
+                                        ::openPMD::Offset{globalOffset},
+                                        ::openPMD::Extent{elements},
+                                        [&storeBfr, params](size_t size) {
+                                            // if there is no special backend support for creating buffers,
+                                            // reuse the storeBfr, deferred flushes need one buffer per component
+                                            if((!storeBfr || params->deferFlush) && size > 0)
+                                            {
+                                                auto const valueSize
+                                                    = std::max(sizeof(StoreType), sizeof(ComponentType));
+                                                storeBfr = std::shared_ptr<char>{
+                                                    new char[size * valueSize],
+                                                    [](char* ptr) { delete[] ptr; }};
+                                            }
+                                            return std::shared_ptr<StoreType>{
+                                                storeBfr,
+                                                reinterpret_cast<StoreType*>(storeBfr.get())};
+                                        })
+                                        .currentBuffer();
+
+                        /* copy strided data from source to temporary buffer */
+                        if(positionBits != 0u)
+                        {
 #pragma omp parallel for simd
-                    for(size_t i = 0; i < elements; ++i)
-                    {
-                        span[i] = reinterpret_cast<ComponentType*>(dataPtr)[d + i * components];
-                    }
-
-                    params->openPMDSeries->flush();
+                            for(size_t i = 0; i < elements; ++i)
+                            {
+                                span[i] = quantizePosition<StoreType>(srcPtr[d + i * components], positionBits);
+                            }
+                        }
+                        else
+                        {
+#pragma omp parallel for simd
+                            for(size_t i = 0; i < elements; ++i)
+                            {
+                                span[i] = roundMantissa(
+                                    static_cast<StoreType>(srcPtr[d + i * components]),
+                                    precision.mantissaBits);
+                            }
+                        }
+                    };
+
+                    if(positionBits > 16u)
+                        storeComponent(bmpl::identity<uint32_t>{});
+                    else if(positionBits > 0u)
+                        storeComponent(bmpl::identity<uint16_t>{});
+                    else if(storeFloat32)
+                        storeComponent(bmpl::identity<float_32>{});
+                    else
+                        storeComponent(bmpl::identity<ComponentType>{});
+
+                    params->flush();
                 }
 
                 auto unitMap = convertToUnitDimension(unitDimension);
@@ -35,13 +35,30 @@ namespace picongpu
 
         ~IIOBackend() override = default;
 
-        //! create a checkpoint
+        /** create a checkpoint
+         *
+         * @param currentStep simulation step
+         * @param checkpointDirectory directory of the checkpoint
+         * @param checkpointFilename filename (prefix) of the checkpoint
+         * @param incremental write only data changed since the last full checkpoint,
+         *                    backends write a full checkpoint if there is no usable full checkpoint
+         */
         virtual void dumpCheckpoint(
             uint32_t currentStep,
             std::string const& checkpointDirectory,
-            std::string const& checkpointFilename)
+            std::string const& checkpointFilename,
+            bool incremental)
             = 0;
 
+        /** check if the checkpoints of several nodes written to node-local directories can be merged
+         *
+         * This requires that each node writes separate files.
+         */
+        virtual bool isNodeLocalCheckpointMergeable() const
+        {
+            return false;
+        }
+
         //! restart from a checkpoint
         virtual void doRestart(
             uint32_t restartStep,
@@ -0,0 +1,184 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/particles/filter/filter.hpp"
+#include "picongpu/plugins/ILightweightPlugin.hpp"
+#include "picongpu/plugins/profiling/Report.hpp"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/mappings/simulation/ResourceMonitor.hpp>
+#include <pmacc/profiling/Profiler.hpp>
+
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace profiling
+        {
+            using namespace pmacc;
+
+            /** report the time spent in each kernel and task per simulation stage
+             *
+             * Enables the pmacc::profiling::Profiler, kernels and tasks are tagged with the simulation stage
+             * (or plugin) that started them.
+             * For each notification the measurements since the previous notification are reduced over all ranks
+             * and the master rank appends one JSON document per line to the output file.
+             * Optionally each rank writes its own measurements to a separate file.
+             *
+             * Enabling the plugin adds timing events to each kernel launch, on accelerators emulating events on
+             * the host (CPU accelerators) each launch becomes blocking.
+             */
+            class Profiling : public ILightweightPlugin
+            {
+            private:
+                MappingDesc* cellDescription = nullptr;
+                ResourceMonitor<simDim> resourceMonitor;
+
+                std::string notifyPeriod;
+                std::string fileName;
+                bool perRank = false;
+                bool pretty = false;
+
+                std::ofstream outFile;
+                std::ofstream rankFile;
+                //! last step measurements were collected for
+                uint32_t lastStep = 0u;
+
+            public:
+                Profiling()
+                {
+                    Environment<>::get().PluginConnector().registerPlugin(this);
+                }
+
+                std::string pluginGetName() const override
+                {
+                    return "Profiling";
+                }
+
+                void pluginRegisterHelp(po::options_description& desc) override
+                {
+                    desc.add_options()(
+                        "profiling.period",
+                        po::value<std::string>(&notifyPeriod),
+                        "report the time of each kernel and task per simulation stage [for each n-th step]")(
+                        "profiling.file",
+                        po::value<std::string>(&fileName)->default_value("profiling.json"),
+                        "output file of the master rank, per rank files are suffixed with the rank")(
+                        "profiling.perRank",
+                        po::value<bool>(&perRank)->zero_tokens(),
+                        "additionally write the measurements of each rank")(
+                        "profiling.pretty",
+                        po::value<bool>(&pretty)->zero_tokens(),
+                        "pretty print the JSON output instead of one document per line");
+                }
+
+                void setMappingDescription(MappingDesc* cellDescription) override
+                {
+                    this->cellDescription = cellDescription;
+                }
+
+                void notify(uint32_t currentStep) override
+                {
+                    // collect first, kernels of this plugin are accounted in the next report
+                    auto const localStatistics = pmacc::profiling::Profiler::get().collect();
+                    uint32_t const numSteps = currentStep - lastStep;
+                    lastStep = currentStep;
+
+                    particles::filter::IUnary<particles::filter::All> parFilter{currentStep};
+                    std::vector<size_t> const particleCounts
+                        = resourceMonitor.getParticleCounts<VectorAllSpecies>(*cellDescription, parFilter);
+                    uint64_t const localParticles
+                        = std::accumulate(particleCounts.begin(), particleCounts.end(), uint64_t(0u));
+
+                    auto& gc = Environment<simDim>::get().GridController();
+                    MPI_Comm comm = gc.getCommunicator().getMPIComm();
+                    uint64_t globalParticles = 0u;
+                    MPI_CHECK(MPI_Reduce(&localParticles, &globalParticles, 1, MPI_UINT64_T, MPI_SUM, 0, comm));
+
+                    auto const globalStatistics = reduce(localStatistics, comm);
+                    if(outFile.is_open())
+                        outFile << toJson(
+                            globalStatistics,
+                            currentStep,
+                            numSteps,
+                            gc.getGlobalSize(),
+                            globalParticles,
+                            pretty)
+                                << std::flush;
+
+                    if(rankFile.is_open())
+                        rankFile << toJson(toReduced(localStatistics), currentStep, numSteps, 1u, localParticles, pretty)
+                                 << std::flush;
+                }
+
+            private:
+                void pluginLoad() override
+                {
+                    if(notifyPeriod.empty())
+                        return;
+
+                    Environment<>::get().PluginConnector().setNotificationPeriod(this, notifyPeriod);
+                    pmacc::profiling::Profiler::get().setEnabled(true);
+                    lastStep = Environment<>::get().SimulationDescription().getCurrentStep();
+
+                    // rank zero of the communicator is the root of the reduction
+                    auto& gc = Environment<simDim>::get().GridController();
+                    if(gc.getGlobalRank() == 0u)
+                        openFile(outFile, fileName);
+                    if(perRank)
+                        openFile(rankFile, fileName + std::string(".") + std::to_string(gc.getGlobalRank()));
+                }
+
+                void pluginUnload() override
+                {
+                    pmacc::profiling::Profiler::get().setEnabled(false);
+                    if(outFile.is_open())
+                        outFile.close();
+                    if(rankFile.is_open())
+                        rankFile.close();
+                }
+
+                void openFile(std::ofstream& file, std::string const& name)
+                {
+                    file.open(name.c_str(), std::ofstream::out | std::ostream::trunc);
+                    if(!file)
+                        std::cerr << "Can't open file [" << name << "] for output, disable plugin output. "
+                                  << std::endl;
+                }
+            };
+
+        } // namespace profiling
+    } // namespace plugins
+} // namespace picongpu
+
+#include <pmacc/mappings/simulation/ResourceMonitor.tpp>
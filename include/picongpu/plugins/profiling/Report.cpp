@@ -0,0 +1,236 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "picongpu/plugins/profiling/Report.hpp"
+
+#include <pmacc/communication/manager_common.hpp>
+
+#include <boost/property_tree/json_parser.hpp>
+#include <boost/property_tree/ptree.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace profiling
+        {
+            namespace
+            {
+                //! join keys into a newline separated string
+                template<typename T_Keys>
+                std::string join(T_Keys const& keys)
+                {
+                    std::string result;
+                    for(auto const& key : keys)
+                        result += key + std::string("\n");
+                    return result;
+                }
+
+                //! split a newline separated string
+                std::vector<std::string> split(std::string const& keys)
+                {
+                    std::vector<std::string> result;
+                    std::istringstream stream(keys);
+                    std::string key;
+                    while(std::getline(stream, key))
+                        result.push_back(key);
+                    return result;
+                }
+
+                /** check if a stage processes the particles of all species
+                 *
+                 * Only for these stages the particle throughput is meaningful.
+                 *
+                 * @param stage stage name, nested stages are checked by the outermost stage
+                 */
+                bool isParticleStage(std::string const& stage)
+                {
+                    static std::set<std::string> const particleStages
+                        = {"momentumBackup",
+                           "collision",
+                           "particleIonization",
+                           "populationKinetics",
+                           "synchrotronRadiation",
+                           "bremsstrahlung",
+                           "particlePush",
+                           "currentDeposition",
+                           "particleSort"};
+                    return particleStages.count(stage.substr(0, stage.find('.'))) != 0u;
+                }
+            } // namespace
+
+            ReducedStatisticsMap reduce(pmacc::profiling::StatisticsMap const& local, MPI_Comm comm)
+            {
+                int rank = 0;
+                int numRanks = 1;
+                MPI_CHECK(MPI_Comm_rank(comm, &rank));
+                MPI_CHECK(MPI_Comm_size(comm, &numRanks));
+
+                // union of the keys of all ranks, gathered and merged on rank 0
+                std::vector<std::string> localKeys;
+                for(auto const& entry : local)
+                    localKeys.push_back(entry.first);
+                std::string const localKeyString = join(localKeys);
+                int localLength = static_cast<int>(localKeyString.size());
+
+                std::vector<int> lengths(rank == 0 ? numRanks : 0);
+                MPI_CHECK(MPI_Gather(&localLength, 1, MPI_INT, lengths.data(), 1, MPI_INT, 0, comm));
+
+                std::vector<int> displacements(lengths.size(), 0);
+                if(!lengths.empty())
+                    std::partial_sum(lengths.begin(), lengths.end() - 1, displacements.begin() + 1);
+                std::vector<char> allKeys(rank == 0 ? displacements.back() + lengths.back() : 0);
+                MPI_CHECK(MPI_Gatherv(
+                    localKeyString.data(),
+                    localLength,
+                    MPI_CHAR,
+                    allKeys.data(),
+                    lengths.data(),
+                    displacements.data(),
+                    MPI_CHAR,
+                    0,
+                    comm));
+
+                std::string globalKeyString;
+                if(rank == 0)
+                {
+                    std::vector<std::string> const keys = split(std::string(allKeys.begin(), allKeys.end()));
+                    globalKeyString = join(std::set<std::string>(keys.begin(), keys.end()));
+                }
+                int globalLength = static_cast<int>(globalKeyString.size());
+                MPI_CHECK(MPI_Bcast(&globalLength, 1, MPI_INT, 0, comm));
+                globalKeyString.resize(globalLength);
+                MPI_CHECK(MPI_Bcast(&globalKeyString[0], globalLength, MPI_CHAR, 0, comm));
+                std::vector<std::string> const globalKeys = split(globalKeyString);
+
+                // measurements of this rank in the order of the global keys
+                size_t const numKeys = globalKeys.size();
+                std::vector<double> time(numKeys, 0.0);
+                // ranks without a measurement must not lower the minimum
+                std::vector<double> timeForMin(numKeys, std::numeric_limits<double>::max());
+                std::vector<uint64_t> counts(2u * numKeys, 0u);
+                for(size_t i = 0u; i < numKeys; ++i)
+                {
+                    auto const it = local.find(globalKeys[i]);
+                    if(it == local.end())
+                        continue;
+                    time[i] = it->second.time;
+                    timeForMin[i] = it->second.time;
+                    counts[i] = it->second.calls;
+                    counts[numKeys + i] = it->second.bytes;
+                }
+
+                std::vector<double> minTime(numKeys), sumTime(numKeys), maxTime(numKeys);
+                std::vector<uint64_t> sumCounts(2u * numKeys);
+                int const count = static_cast<int>(numKeys);
+                MPI_CHECK(MPI_Reduce(timeForMin.data(), minTime.data(), count, MPI_DOUBLE, MPI_MIN, 0, comm));
+                MPI_CHECK(MPI_Reduce(time.data(), sumTime.data(), count, MPI_DOUBLE, MPI_SUM, 0, comm));
+                MPI_CHECK(MPI_Reduce(time.data(), maxTime.data(), count, MPI_DOUBLE, MPI_MAX, 0, comm));
+                MPI_CHECK(
+                    MPI_Reduce(counts.data(), sumCounts.data(), 2 * count, MPI_UINT64_T, MPI_SUM, 0, comm));
+
+                ReducedStatisticsMap result;
+                if(rank != 0)
+                    return result;
+
+                for(size_t i = 0u; i < numKeys; ++i)
+                {
+                    ReducedStatistics& stats = result[globalKeys[i]];
+                    stats.calls = sumCounts[i];
+                    stats.minTime = minTime[i];
+                    stats.sumTime = sumTime[i];
+                    stats.maxTime = maxTime[i];
+                    stats.bytes = sumCounts[numKeys + i];
+                }
+                return result;
+            }
+
+            ReducedStatisticsMap toReduced(pmacc::profiling::StatisticsMap const& local)
+            {
+                ReducedStatisticsMap result;
+                for(auto const& entry : local)
+                {
+                    ReducedStatistics& stats = result[entry.first];
+                    stats.calls = entry.second.calls;
+                    stats.minTime = stats.sumTime = stats.maxTime = entry.second.time;
+                    stats.bytes = entry.second.bytes;
+                }
+                return result;
+            }
+
+            std::string toJson(
+                ReducedStatisticsMap const& statistics,
+                uint32_t const currentStep,
+                uint32_t const numSteps,
+                uint32_t const numRanks,
+                uint64_t const numMacroParticles,
+                bool const pretty)
+            {
+                using boost::property_tree::ptree;
+
+                // avoid a division by zero for reports without a simulated step, e.g. the initialization
+                double const steps = static_cast<double>(std::max(numSteps, 1u));
+
+                ptree pt;
+                pt.put("step", currentStep);
+                pt.put("numSteps", numSteps);
+                pt.put("numRanks", numRanks);
+                pt.put("macroParticles", numMacroParticles);
+
+                ptree entries;
+                for(auto const& entry : statistics)
+                {
+                    ReducedStatistics const& stats = entry.second;
+                    size_t const separator = entry.first.find('/');
+                    std::string const stage = entry.first.substr(0, separator);
+
+                    ptree node;
+                    node.put("stage", stage);
+                    node.put("name", entry.first.substr(separator + 1u));
+                    node.put("callsPerStep", static_cast<double>(stats.calls) / steps / numRanks);
+                    node.put("timePerStep.min", stats.minTime / steps);
+                    node.put("timePerStep.mean", stats.sumTime / steps / numRanks);
+                    node.put("timePerStep.max", stats.maxTime / steps);
+                    node.put("bytesPerStep", static_cast<double>(stats.bytes) / steps);
+                    // the slowest rank bounds the throughput of all ranks
+                    if(isParticleStage(stage))
+                        node.put(
+                            "particlesPerSecond",
+                            stats.maxTime > 0.0 ? static_cast<double>(numMacroParticles) * steps / stats.maxTime
+                                                : 0.0);
+                    entries.push_back(std::make_pair("", node));
+                }
+                pt.add_child("entries", entries);
+
+                std::stringstream ss;
+                write_json(ss, pt, pretty);
+                return ss.str();
+            }
+        } // namespace profiling
+    } // namespace plugins
+} // namespace picongpu
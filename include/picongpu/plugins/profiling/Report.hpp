@@ -0,0 +1,87 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <pmacc/profiling/Statistics.hpp>
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <mpi.h>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace profiling
+        {
+            //! measurements of a kernel or task reduced over all ranks
+            struct ReducedStatistics
+            {
+                //! sum of the calls of all ranks
+                uint64_t calls = 0u;
+                /** minimum, sum and maximum of the time of all ranks in seconds
+                 *
+                 * The minimum ignores ranks without a measurement.
+                 */
+                double minTime = 0.0;
+                double sumTime = 0.0;
+                double maxTime = 0.0;
+                //! sum of the bytes moved by all ranks
+                uint64_t bytes = 0u;
+            };
+
+            using ReducedStatisticsMap = std::map<std::string, ReducedStatistics>;
+
+            /** reduce the measurements of all ranks
+             *
+             * Collective operation, each rank can provide a different set of keys.
+             * Missing keys are accounted as zero.
+             *
+             * @param local measurements of this rank
+             * @param comm communicator of all ranks
+             * @return reduced measurements, only valid on rank 0 of comm
+             */
+            ReducedStatisticsMap reduce(pmacc::profiling::StatisticsMap const& local, MPI_Comm comm);
+
+            //! convert the measurements of a single rank
+            ReducedStatisticsMap toReduced(pmacc::profiling::StatisticsMap const& local);
+
+            /** create a JSON report
+             *
+             * @param statistics measurements
+             * @param currentStep simulation step of the report
+             * @param numSteps number of simulation steps covered by the measurements
+             * @param numRanks number of ranks the measurements are reduced over
+             * @param numMacroParticles number of macro particles of all species on these ranks
+             * @param pretty pretty print the JSON document, else the document is written in a single line
+             */
+            std::string toJson(
+                ReducedStatisticsMap const& statistics,
+                uint32_t currentStep,
+                uint32_t numSteps,
+                uint32_t numRanks,
+                uint64_t numMacroParticles,
+                bool pretty);
+        } // namespace profiling
+    } // namespace plugins
+} // namespace picongpu
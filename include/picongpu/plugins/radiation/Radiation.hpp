@@ -47,7 +47,9 @@
 #include <fstream>
 #include <iostream>
 #include <memory>
+#include <stdexcept>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include <openPMD/openPMD.hpp>
@@ -97,6 +99,14 @@ namespace picongpu
                  * line option numJobs is > 1.
                  */
                 std::unique_ptr<GridBuffer<Amplitude, 2>> radiation;
+
+                /**
+                 * Object that stores the non-uniform FFT grids of all observers on host and
+                 * device if the NUFFT backend is used, see NufftGrid for the layout.
+                 * The amplitudes are obtained from it in copyRadiationDeviceToHost().
+                 */
+                std::unique_ptr<GridBuffer<float_64, 2>> nufftSamples;
+                std::unique_ptr<NufftGrid> nufftGrid;
                 radiation_frequencies::InitFreqFunctor freqInit;
                 radiation_frequencies::FreqFunctor freqFkt;
 
@@ -118,6 +128,8 @@ namespace picongpu
                 std::string folderRadPerGPU;
                 DataSpace<simDim> lastGPUpos;
                 int numJobs;
+                bool useNufft;
+                bool observerTiling;
 
                 /**
                  * Data structure for storage and summation of the intermediate values of
@@ -224,7 +236,16 @@ namespace picongpu
                         "folder in which the radiation of each GPU is written")(
                         (pluginPrefix + ".numJobs").c_str(),
                         po::value<int>(&numJobs)->default_value(2),
-                        "Number of independent jobs used for the radiation calculation.");
+                        "Number of independent jobs used for the radiation calculation.")(
+                        (pluginPrefix + ".nufft").c_str(),
+                        po::bool_switch(&useNufft),
+                        "compute the spectra by a non-uniform FFT at output time instead of evaluating every "
+                        "frequency in each time step, requires linear frequencies and a frequency independent form "
+                        "factor, the Nyquist low pass is not applied")(
+                        (pluginPrefix + ".observerTiling").c_str(),
+                        po::value<bool>(&observerTiling)->default_value(true),
+                        "use the observer-tiled radiation kernel on accelerators with one worker per block (CPUs), "
+                        "ignored otherwise");
                 }
 
 
@@ -320,6 +341,32 @@ namespace picongpu
                         freqInit.Init(frequencies_from_list::listLocation);
                         freqFkt = freqInit.getFunctor();
 
+                        if(useNufft)
+                        {
+                            constexpr bool isLinearFrequencies = std::is_same<
+                                radiation_frequencies::FreqFunctor,
+                                linear_frequencies::FreqFunctor>::value;
+                            using FormFactor = radFormFactor::radFormFactor;
+                            constexpr bool isFormFactorFrequencyIndependent
+                                = std::is_same<FormFactor, radFormFactor_coherent::radFormFactor>::value
+                                || std::is_same<FormFactor, radFormFactor_incoherent::radFormFactor>::value;
+                            if(!isLinearFrequencies || !isFormFactorFrequencyIndependent)
+                                throw std::runtime_error(
+                                    "Radiation (" + speciesName
+                                    + "): the NUFFT backend requires linear_frequencies and radFormFactor_coherent or "
+                                      "radFormFactor_incoherent in radiation.param");
+
+                            nufftGrid = std::make_unique<NufftGrid>(
+                                radiation_frequencies::N_omega,
+                                float_64(linear_frequencies::omega_min),
+                                float_64(linear_frequencies::delta_omega));
+                            nufftSamples = std::make_unique<GridBuffer<float_64, 2>>(DataSpace<2>(
+                                nufftGrid->getNumPoints() * NufftGrid::valuesPerPoint,
+                                parameters::N_observer));
+                            log<radLog::SIMULATION_STATE>("Radiation (%1%): use NUFFT backend with %2% grid points")
+                                % speciesName % nufftGrid->getNumPoints();
+                        }
+
                         Environment<>::get().PluginConnector().setNotificationPeriod(this, notifyPeriod);
                         pmacc::Filesystem<simDim>& fs = Environment<simDim>::get().Filesystem();
 
@@ -400,6 +447,12 @@ namespace picongpu
                 /** Method to copy data from GPU to CPU */
                 void copyRadiationDeviceToHost()
                 {
+                    if(useNufft)
+                    {
+                        transformNufftSamples();
+                        return;
+                    }
+
                     radiation->deviceToHost();
                     __getTransactionEvent().waitForFinished();
 
@@ -414,6 +467,27 @@ namespace picongpu
                 }
 
 
+                /** Transform the non-uniform FFT grids to the amplitudes of all observers
+                 *
+                 * The result is stored like the result of copyRadiationDeviceToHost() in
+                 * y index zero of the host buffer of the amplitudes.
+                 */
+                void transformNufftSamples()
+                {
+                    nufftSamples->deviceToHost();
+                    __getTransactionEvent().waitForFinished();
+
+                    auto samplesBox = nufftSamples->getHostBuffer().getDataBox();
+                    auto dbox = radiation->getHostBuffer().getDataBox();
+                    std::vector<Amplitude> amplitudes(radiation_frequencies::N_omega);
+                    for(uint32_t observerIdx = 0; observerIdx < parameters::N_observer; ++observerIdx)
+                    {
+                        nufftGrid->transform(samplesBox, observerIdx, amplitudes.data());
+                        for(uint32_t o = 0; o < radiation_frequencies::N_omega; ++o)
+                            dbox(DataSpace<2>(observerIdx * radiation_frequencies::N_omega + o, 0)) = amplitudes[o];
+                    }
+                }
+
                 /** write radiation from each GPU to file individually
                  *  requires call of copyRadiationDeviceToHost() before */
                 void saveRadPerGPU(const DataSpace<simDim> currentGPUpos)
@@ -1021,19 +1095,53 @@ namespace picongpu
                         = pmacc::traits::GetNumWorkers<pmacc::math::CT::volume<SuperCellSize>::type::value>::value;
 
 
-                    // PIC-like kernel call of the radiation kernel
-                    PMACC_KERNEL(KernelRadiationParticles<numWorkers>{})
-                    (DataSpace<2>(gridDim_rad, numJobs), DataSpace<2>(numWorkers, 1))(
-                        /*Pointer to particles memory on the device*/
-                        particles->getDeviceParticlesBox(),
-
-                        /*Pointer to memory of radiated amplitude on the device*/
-                        radiation->getDeviceBuffer().getDataBox(),
-                        globalOffset,
-                        currentStep,
-                        *cellDescription,
-                        freqFkt,
-                        subGrid.getGlobalDomain().size);
+                    if(useNufft)
+                    {
+                        PMACC_KERNEL(KernelRadiationParticlesNufft<numWorkers>{})
+                        (DataSpace<2>(gridDim_rad, numJobs), DataSpace<2>(numWorkers, 1))(
+                            particles->getDeviceParticlesBox(),
+                            nufftSamples->getDeviceBuffer().getDataBox(),
+                            globalOffset,
+                            currentStep,
+                            *cellDescription,
+                            *nufftGrid,
+                            subGrid.getGlobalDomain().size);
+                    }
+                    else if(observerTiling && numWorkers == 1u)
+                    {
+                        /* CPU: a block handles several directions to reuse the loaded frame,
+                         * the shared memory grows linearly with observersPerBlock
+                         */
+                        constexpr uint32_t observersPerBlock = 4u;
+                        constexpr uint32_t frequenciesPerChunk = 16u;
+                        int const numObserverTiles = (N_observer + observersPerBlock - 1) / observersPerBlock;
+                        PMACC_KERNEL(
+                            KernelRadiationParticlesTiled<numWorkers, observersPerBlock, frequenciesPerChunk>{})
+                        (DataSpace<2>(numObserverTiles, numJobs), DataSpace<2>(numWorkers, 1))(
+                            particles->getDeviceParticlesBox(),
+                            radiation->getDeviceBuffer().getDataBox(),
+                            globalOffset,
+                            currentStep,
+                            *cellDescription,
+                            freqFkt,
+                            subGrid.getGlobalDomain().size);
+                    }
+                    else
+                    {
+                        // PIC-like kernel call of the radiation kernel
+                        PMACC_KERNEL(KernelRadiationParticles<numWorkers>{})
+                        (DataSpace<2>(gridDim_rad, numJobs), DataSpace<2>(numWorkers, 1))(
+                            /*Pointer to particles memory on the device*/
+                            particles->getDeviceParticlesBox(),
+
+                            /*Pointer to memory of radiated amplitude on the device*/
+                            radiation->getDeviceBuffer().getDataBox(),
+                            globalOffset,
+                            currentStep,
+                            *cellDescription,
+                            freqFkt,
+                            subGrid.getGlobalDomain().size);
+                    }
 
                     if(dumpPeriod != 0 && currentStep % dumpPeriod == 0)
                     {
@@ -1045,6 +1153,8 @@ namespace picongpu
 
                         // reset amplitudes on GPU back to zero
                         radiation->getDeviceBuffer().reset(false);
+                        if(useNufft)
+                            nufftSamples->getDeviceBuffer().reset(false);
                     }
                 }
             };
@@ -0,0 +1,242 @@
+/* Copyright 2013-2021 Heiko Burau, Rene Widera, Richard Pausch, Sergei Bastrakov
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/plugins/radiation/VectorTypes.hpp"
+#include "picongpu/plugins/radiation/amplitude.hpp"
+
+#include <pmacc/kernel/atomic.hpp>
+
+#include <complex>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+
+namespace picongpu
+{
+    namespace plugins
+    {
+        namespace radiation
+        {
+            /** Non-uniform FFT of the radiation amplitudes for linearly spaced frequencies
+             *
+             * The amplitude at frequency omega_o = omega_min + o * delta_omega is the sum over
+             * all particle contributions c_j * exp(i * omega_o * t_j).
+             * Instead of evaluating this sum for every frequency, each contribution is spread
+             * with a Gaussian kernel onto a uniform, oversampled grid of the periodic variable
+             * x_j = delta_omega * t_j. At output time, one FFT per observer and component and a
+             * deconvolution of the Gaussian yield the amplitudes at all frequencies.
+             * The parameters follow Greengard and Lee, SIAM Review 46(3), 443 (2004). With 12 grid points on
+             * each side of a sample the relative error compared to the direct sum is about 1e-11, 6 points
+             * would only give about 1e-6.
+             *
+             * The grid stores the real and imaginary part of the three amplitude components for
+             * each grid point and observer as float_64 in a 2D buffer of
+             * size (numPoints * valuesPerPoint, N_observer).
+             */
+            class NufftGrid
+            {
+            public:
+                //! number of grid points on each side of a sample the sample is spread to
+                static constexpr int spreadWidth = 12;
+                //! number of values per grid point: real and imaginary part of the three components
+                static constexpr uint32_t valuesPerPoint = 6u;
+
+                /** Set up the grid
+                 *
+                 * @param numFrequencies number of frequencies
+                 * @param omegaMin lowest frequency
+                 * @param deltaOmega difference between two frequencies
+                 */
+                HINLINE NufftGrid(uint32_t const numFrequencies, float_64 const omegaMin, float_64 const deltaOmega)
+                    : numFrequencies(numFrequencies)
+                    , deltaOmega(deltaOmega)
+                {
+                    // oversample by at least a factor of two, a power of two keeps the FFT radix-2
+                    numPoints = 1u;
+                    while(numPoints < 2u * numFrequencies)
+                        numPoints *= 2u;
+                    float_64 const ratio = float_64(numPoints) / float_64(numFrequencies);
+                    tau = pmacc::math::Pi<float_64>::value * float_64(spreadWidth)
+                        / (float_64(numFrequencies) * float_64(numFrequencies) * ratio * (ratio - 0.5));
+                    gridSpacing = 2.0 * pmacc::math::Pi<float_64>::value / float_64(numPoints);
+                    // center the frequency range around zero to keep the deconvolution factor small
+                    centerOmega = omegaMin + float_64(numFrequencies / 2u) * deltaOmega;
+                }
+
+                //! number of grid points per observer
+                HINLINE uint32_t getNumPoints() const
+                {
+                    return numPoints;
+                }
+
+                /** Spread the contribution of a particle to the grid of an observer
+                 *
+                 * @param acc alpaka accelerator
+                 * @param samples data box of the grid, see class description
+                 * @param observerIdx index of the observation direction
+                 * @param amplitude real amplitude of the particle, including the form factor
+                 * @param tRet retarded time of the particle
+                 */
+                template<typename T_Acc, typename T_SampleBox>
+                DINLINE void spread(
+                    T_Acc const& acc,
+                    T_SampleBox samples,
+                    int const observerIdx,
+                    vector_64 const& amplitude,
+                    float_64 const tRet) const
+                {
+                    constexpr float_64 twoPi = 2.0 * pmacc::math::Pi<float_64>::value;
+
+                    // phase shift to the center frequency, reduced to [0, 2pi) before sincos
+                    float_64 phase = centerOmega * tRet;
+                    phase -= twoPi * math::floor(phase / twoPi);
+                    float_64 sinPhase;
+                    float_64 cosPhase;
+                    pmacc::math::sincos(phase, sinPhase, cosPhase);
+
+                    // position of the sample on the periodic grid in units of grid points
+                    float_64 position = deltaOmega * tRet / gridSpacing;
+                    position -= float_64(numPoints) * math::floor(position / float_64(numPoints));
+                    int const nearestPoint = static_cast<int>(math::floor(position));
+
+                    for(int i = 1 - spreadWidth; i <= spreadWidth; ++i)
+                    {
+                        int const point = nearestPoint + i;
+                        float_64 const distance = (position - float_64(point)) * gridSpacing;
+                        float_64 const weight = math::exp(-distance * distance / (4.0 * tau));
+                        uint32_t const pointIdx = static_cast<uint32_t>(
+                                                      (point + static_cast<int>(numPoints))
+                                                      % static_cast<int>(numPoints))
+                            * valuesPerPoint;
+                        for(uint32_t d = 0u; d < 3u; ++d)
+                        {
+                            float_64 const value = amplitude[d] * weight;
+                            cupla::atomicAdd(
+                                acc,
+                                &samples(DataSpace<2>(pointIdx + 2u * d, observerIdx)),
+                                value * cosPhase,
+                                ::alpaka::hierarchy::Blocks{});
+                            cupla::atomicAdd(
+                                acc,
+                                &samples(DataSpace<2>(pointIdx + 2u * d + 1u, observerIdx)),
+                                value * sinPhase,
+                                ::alpaka::hierarchy::Blocks{});
+                        }
+                    }
+                }
+
+                /** Transform the grid of an observer to the amplitudes at all frequencies
+                 *
+                 * @param samples host data box of the grid, see class description
+                 * @param observerIdx index of the observation direction
+                 * @param[out] amplitudes numFrequencies amplitudes
+                 */
+                template<typename T_SampleBox>
+                HINLINE void transform(T_SampleBox samples, int const observerIdx, Amplitude<>* amplitudes) const
+                {
+                    float_64 const sqrtPiOverTau = std::sqrt(pmacc::math::Pi<float_64>::value / tau);
+                    std::vector<std::complex<float_64>> values(numPoints);
+                    std::vector<std::complex<float_64>> result(numFrequencies * 3u);
+
+                    for(uint32_t d = 0u; d < 3u; ++d)
+                    {
+                        for(uint32_t m = 0u; m < numPoints; ++m)
+                        {
+                            uint32_t const valueIdx = m * valuesPerPoint + 2u * d;
+                            values[m] = std::complex<float_64>(
+                                samples(DataSpace<2>(valueIdx, observerIdx)),
+                                samples(DataSpace<2>(valueIdx + 1u, observerIdx)));
+                        }
+                        fft(values);
+                        for(uint32_t o = 0u; o < numFrequencies; ++o)
+                        {
+                            int const k = static_cast<int>(o) - static_cast<int>(numFrequencies / 2u);
+                            int const signedIdx = (k + static_cast<int>(numPoints)) % static_cast<int>(numPoints);
+                            uint32_t const idx = static_cast<uint32_t>(signedIdx);
+                            float_64 const deconvolution
+                                = sqrtPiOverTau * std::exp(float_64(k) * float_64(k) * tau) / float_64(numPoints);
+                            result[o * 3u + d] = values[idx] * deconvolution;
+                        }
+                    }
+
+                    for(uint32_t o = 0u; o < numFrequencies; ++o)
+                        amplitudes[o] = Amplitude<>(
+                            result[o * 3u].real(),
+                            result[o * 3u].imag(),
+                            result[o * 3u + 1u].real(),
+                            result[o * 3u + 1u].imag(),
+                            result[o * 3u + 2u].real(),
+                            result[o * 3u + 2u].imag());
+                }
+
+            private:
+                /** In-place radix-2 FFT with a positive exponent and without normalization
+                 *
+                 * @param values data, the size must be a power of two
+                 */
+                static void fft(std::vector<std::complex<float_64>>& values)
+                {
+                    uint32_t const size = static_cast<uint32_t>(values.size());
+
+                    // bit reversal permutation
+                    for(uint32_t i = 1u, j = 0u; i < size; ++i)
+                    {
+                        uint32_t bit = size >> 1u;
+                        for(; j & bit; bit >>= 1u)
+                            j ^= bit;
+                        j ^= bit;
+                        if(i < j)
+                            std::swap(values[i], values[j]);
+                    }
+
+                    for(uint32_t length = 2u; length <= size; length <<= 1u)
+                    {
+                        float_64 const angle = 2.0 * pmacc::math::Pi<float_64>::value / float_64(length);
+                        std::complex<float_64> const root(std::cos(angle), std::sin(angle));
+                        for(uint32_t start = 0u; start < size; start += length)
+                        {
+                            std::complex<float_64> twiddle(1.0, 0.0);
+                            for(uint32_t k = 0u; k < length / 2u; ++k)
+                            {
+                                std::complex<float_64> const even = values[start + k];
+                                std::complex<float_64> const odd = values[start + k + length / 2u] * twiddle;
+                                values[start + k] = even + odd;
+                                values[start + k + length / 2u] = even - odd;
+                                twiddle *= root;
+                            }
+                        }
+                    }
+                }
+
+                uint32_t numFrequencies;
+                uint32_t numPoints;
+                float_64 deltaOmega;
+                float_64 centerOmega;
+                float_64 tau;
+                float_64 gridSpacing;
+            };
+
+        } // namespace radiation
+    } // namespace plugins
+} // namespace picongpu
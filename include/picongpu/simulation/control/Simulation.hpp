@@ -53,6 +53,7 @@
 #include "picongpu/simulation/stage/ParticleBoundaries.hpp"
 #include "picongpu/simulation/stage/ParticleIonization.hpp"
 #include "picongpu/simulation/stage/ParticlePush.hpp"
+#include "picongpu/simulation/stage/ParticleSort.hpp"
 #include "picongpu/simulation/stage/PopulationKinetics.hpp"
 #include "picongpu/simulation/stage/SynchrotronRadiation.hpp"
 #include "picongpu/versionFormat.hpp"
@@ -64,6 +65,7 @@
 #include <pmacc/mappings/kernel/MappingDescription.hpp>
 #include <pmacc/mappings/simulation/GridController.hpp>
 #include <pmacc/mappings/simulation/SubGrid.hpp>
+#include <pmacc/profiling/Profiler.hpp>
 #include <pmacc/random/RNGProvider.hpp>
 #include <pmacc/random/methods/methods.hpp>
 #include <pmacc/simulationControl/SimulationHelper.hpp>
@@ -131,6 +133,8 @@ namespace picongpu
             fieldAbsorber.registerHelp(desc);
             fieldBackground.registerHelp(desc);
             particleBoundaries.registerHelp(desc);
+            particlePush.registerHelp(desc);
+            particleSort.registerHelp(desc);
             // clang-format off
             desc.add_options()(
                 "versionOnce", po::value<bool>(&showVersionOnce)->zero_tokens(),
@@ -161,7 +165,11 @@ namespace picongpu
                 ("autoAdjustGrid", po::value<bool>(&autoAdjustGrid)->default_value(true),
                  "auto adjust the grid size if PIConGPU conditions are not fulfilled")
                 ("numRanksPerDevice,r", po::value<uint32_t>(&numRanksPerDevice)->default_value(1u),
-                 "set the number of MPI ranks using a single device together");
+                 "set the number of MPI ranks using a single device together")
+                ("fieldSolver.temporalBlocking", po::value<bool>(&fieldSolverTemporalBlocking)->zero_tokens(),
+                 "update B and E of the core in a single pass per supercell ordered by wavefronts, "
+                 "reduces memory traffic of the FDTD solver on CPUs, "
+                 "ignored if not supported by the field solver configuration");
             // clang-format on
         }
 
@@ -312,7 +320,7 @@ namespace picongpu
             initFields(dc);
 
             // create field solver
-            myFieldSolver = std::make_unique<fields::Solver>(*cellDescription);
+            myFieldSolver = std::make_unique<fields::Solver>(*cellDescription, fieldSolverTemporalBlocking);
 
             // initialize field background stage,
             // this may include allocation of additional fields so has to be done before particles
@@ -321,6 +329,9 @@ namespace picongpu
             // initialize particle boundaries
             particleBoundaries.init();
 
+            // initialize particle push
+            particlePush.init();
+
             // Initialize random number generator and synchrotron functions, if there are synchrotron or bremsstrahlung
             // Photons
             using AllSynchrotronPhotonsSpecies =
@@ -532,26 +543,81 @@ namespace picongpu
         void runOneStep(uint32_t currentStep) override
         {
             using namespace simulation::stage;
+            // kernels and tasks are tagged with the stage name for the profiling plugin
+            using pmacc::profiling::ScopedStage;
 
-            IterationStart{}(currentStep);
-            MomentumBackup{}(currentStep);
-            CurrentReset{}(currentStep);
-            Collision{deviceHeap}(currentStep);
-            ParticleIonization{*cellDescription}(currentStep);
-            PopulationKinetics{}(currentStep);
-            SynchrotronRadiation{*cellDescription, synchrotronFunctions}(currentStep);
+            {
+                ScopedStage profilingStage("iterationStart");
+                IterationStart{}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("momentumBackup");
+                MomentumBackup{}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("currentReset");
+                CurrentReset{}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("collision");
+                Collision{deviceHeap}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("particleIonization");
+                ParticleIonization{*cellDescription}(currentStep, particlePush.isFieldIonizationMerged());
+            }
+            {
+                ScopedStage profilingStage("populationKinetics");
+                PopulationKinetics{}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("synchrotronRadiation");
+                SynchrotronRadiation{*cellDescription, synchrotronFunctions}(currentStep);
+            }
 #if(PMACC_CUDA_ENABLED == 1)
-            Bremsstrahlung{*cellDescription, scaledBremsstrahlungSpectrumMap, bremsstrahlungPhotonAngle}(currentStep);
+            {
+                ScopedStage profilingStage("bremsstrahlung");
+                Bremsstrahlung{*cellDescription, scaledBremsstrahlungSpectrumMap, bremsstrahlungPhotonAngle}(
+                    currentStep);
+            }
 #endif
             EventTask commEvent;
-            ParticlePush{}(currentStep, commEvent);
-            fieldBackground.subtract(currentStep);
-            myFieldSolver->update_beforeCurrent(currentStep);
+            {
+                ScopedStage profilingStage("particlePush");
+                particlePush(currentStep, commEvent);
+            }
+            {
+                ScopedStage profilingStage("fieldBackground");
+                fieldBackground.subtract(currentStep);
+            }
+            {
+                ScopedStage profilingStage("fieldSolver");
+                myFieldSolver->update_beforeCurrent(currentStep);
+            }
             __setTransactionEvent(commEvent);
-            CurrentBackground{*cellDescription}(currentStep);
-            CurrentDeposition{}(currentStep);
-            currentInterpolationAndAdditionToEMF(currentStep);
-            myFieldSolver->update_afterCurrent(currentStep);
+            {
+                ScopedStage profilingStage("currentBackground");
+                CurrentBackground{*cellDescription}(currentStep);
+            }
+            {
+                ScopedStage profilingStage("currentDeposition");
+                CurrentDeposition{}(
+                    currentStep,
+                    particlePush.isCurrentDepositionFused(),
+                    particlePush.isFieldIonizationMerged());
+            }
+            {
+                ScopedStage profilingStage("currentInterpolationAndAdditionToEMF");
+                currentInterpolationAndAdditionToEMF(currentStep);
+            }
+            {
+                ScopedStage profilingStage("fieldSolver");
+                myFieldSolver->update_afterCurrent(currentStep);
+            }
+            {
+                ScopedStage profilingStage("particleSort");
+                particleSort(currentStep);
+            }
         }
 
         void movingWindowCheck(uint32_t currentStep) override
@@ -633,6 +699,12 @@ namespace picongpu
         // Because of it, has a special init() method that has to be called during initialization of the simulation
         simulation::stage::ParticleBoundaries particleBoundaries;
 
+        // Particle push stage, has to live always as it is used for registering options like a plugin
+        simulation::stage::ParticlePush particlePush;
+
+        // Particle sort stage, has to live always as it is used for registering options like a plugin
+        simulation::stage::ParticleSort particleSort;
+
 #if(PMACC_CUDA_ENABLED == 1)
         // creates lookup tables for the bremsstrahlung effect
         // map<atomic number, scaled bremsstrahlung spectrum>
@@ -664,6 +736,7 @@ namespace picongpu
         bool showVersionOnce{false};
         bool autoAdjustGrid = true;
         uint32_t numRanksPerDevice = 1u;
+        bool fieldSolverTemporalBlocking = false;
 
     private:
         /** Get available memory on device
@@ -23,6 +23,7 @@
 
 #include "picongpu/fields/FieldJ.hpp"
 #include "picongpu/particles/collision/collision.hpp"
+#include "picongpu/particles/collision/detail/ListPool.hpp"
 
 #include <pmacc/Environment.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
@@ -30,7 +31,10 @@
 #include <pmacc/particles/traits/FilterByFlag.hpp>
 #include <pmacc/type/Area.hpp>
 
+#include <boost/mpl/empty.hpp>
+
 #include <cstdint>
+#include <memory>
 
 
 namespace picongpu
@@ -53,9 +57,22 @@ namespace picongpu
                  */
                 void operator()(uint32_t const step) const
                 {
+                    using ListPool = particles::collision::detail::ListPool;
+
+                    if(bmpl::empty<particles::collision::CollisionPipeline>::value)
+                        return;
+
+                    // the particle list pool persists over time steps, it is sized by the demand of the last step
+                    DataConnector& dc = Environment<>::get().DataConnector();
+                    if(!dc.hasId(ListPool::getName()))
+                        dc.share(std::make_shared<ListPool>());
+                    auto listPool = dc.get<ListPool>(ListPool::getName(), true);
+
+                    listPool->reset();
                     pmacc::meta::ForEach<
                         particles::collision::CollisionPipeline,
                         particles::collision::CallCollider<bmpl::_1>>{}(m_heap, step);
+                    listPool->update();
                 }
 
             private:
@@ -24,11 +24,14 @@
 #include "picongpu/simulation_defines.hpp"
 
 #include "picongpu/fields/FieldJ.hpp"
+#include "picongpu/particles/ionization/byField/CanMergeIntoPush.hpp"
+#include "picongpu/particles/traits/CanFuseCurrentDeposition.hpp"
 
 #include <pmacc/Environment.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
 #include <pmacc/meta/ForEach.hpp>
 #include <pmacc/particles/traits/FilterByFlag.hpp>
+#include <pmacc/traits/HasFlag.hpp>
 #include <pmacc/type/Area.hpp>
 
 #include <cstdint>
@@ -48,8 +51,22 @@ namespace picongpu
                     using SpeciesType = T_SpeciesType;
                     using FrameType = typename SpeciesType::FrameType;
 
-                    HINLINE void operator()(const uint32_t currentStep, FieldJ& fieldJ, pmacc::DataConnector& dc) const
+                    HINLINE void operator()(
+                        const uint32_t currentStep,
+                        FieldJ& fieldJ,
+                        pmacc::DataConnector& dc,
+                        bool const skipPushedSpecies,
+                        bool const mergeFieldIonization) const
                     {
+                        using CanFuseCurrentDeposition =
+                            typename particles::traits::CanFuseCurrentDeposition<SpeciesType>::type;
+                        using CanMergeIntoPush = typename particles::ionization::CanMergeIntoPush<SpeciesType>::type;
+                        // a push merged with the ionization does not deposit the current
+                        bool const isPushMerged = mergeFieldIonization && CanMergeIntoPush::value;
+                        // the current was already deposited within the particle push
+                        if(skipPushedSpecies && CanFuseCurrentDeposition::value && !isPushMerged)
+                            return;
+
                         auto species = dc.get<SpeciesType>(FrameType::getName(), true);
                         fieldJ.computeCurrent<T_Area::value, SpeciesType>(*species, currentStep);
                     }
@@ -64,8 +81,16 @@ namespace picongpu
                  *  density
                  *
                  * @param step index of time iteration
+                 * @param skipPushedSpecies skip species for which particles::traits::CanFuseCurrentDeposition holds,
+                 *                          used if the current of these species was deposited within the particle
+                 *                          push
+                 * @param mergeFieldIonization the field ionization was merged into the push, these species are
+                 *                             not skipped
                  */
-                void operator()(uint32_t const step) const
+                void operator()(
+                    uint32_t const step,
+                    bool const skipPushedSpecies = false,
+                    bool const mergeFieldIonization = false) const
                 {
                     using namespace pmacc;
                     DataConnector& dc = Environment<>::get().DataConnector();
@@ -76,7 +101,7 @@ namespace picongpu
                         SpeciesWithCurrentSolver,
                         detail::CurrentDeposition<bmpl::_1, bmpl::int_<type::CORE + type::BORDER>>>
                         depositCurrent;
-                    depositCurrent(step, fieldJ, dc);
+                    depositCurrent(step, fieldJ, dc, skipPushedSpecies, mergeFieldIonization);
                 }
             };
 
@@ -26,6 +26,7 @@
 #include "picongpu/fields/FieldB.hpp"
 #include "picongpu/fields/FieldE.hpp"
 #include "picongpu/fields/background/cellwiseOperation.hpp"
+#include "picongpu/simulation/control/MovingWindow.hpp"
 
 #include <pmacc/Environment.hpp>
 #include <pmacc/dataManagement/DataConnector.hpp>
@@ -37,6 +38,7 @@
 #include <cstdint>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
 
 
 namespace picongpu
@@ -47,6 +49,68 @@ namespace picongpu
         {
             namespace detail
             {
+                /* Helper to check if a member exists
+                 *
+                 * Derived from C++17 std::void_t.
+                 */
+                template<class...>
+                using Void = void;
+
+                /** Check if a field background does not depend on the time step
+                 *
+                 * A background is time-independent if it defines a member
+                 * `static constexpr bool IsTimeIndependent = true;`, the default is false.
+                 *
+                 * @tparam T_FieldBackground field background, e.g. picongpu::FieldBackgroundE
+                 * @{
+                 */
+                template<typename T_FieldBackground, typename T_Sfinae = void>
+                struct IsTimeIndependent : std::false_type
+                {
+                };
+
+                template<typename T_FieldBackground>
+                struct IsTimeIndependent<T_FieldBackground, Void<decltype(T_FieldBackground::IsTimeIndependent)>>
+                    : std::integral_constant<bool, T_FieldBackground::IsTimeIndependent>
+                {
+                };
+                /** @} */
+
+                /** Background functor reading precomputed background values
+                 *
+                 * @tparam T_DataBox data box type of the precomputed values with the layout of a field
+                 */
+                template<typename T_DataBox>
+                struct CachedFieldBackground
+                {
+                    /** Create the functor
+                     *
+                     * @param cacheBox precomputed background values
+                     * @param originCellIdx total cell index of the first cell of cacheBox
+                     */
+                    HINLINE CachedFieldBackground(T_DataBox const& cacheBox, DataSpace<simDim> const& originCellIdx)
+                        : cacheBox(cacheBox)
+                        , originCellIdx(originCellIdx)
+                    {
+                    }
+
+                    /** Get the precomputed background value
+                     *
+                     * @param cellIdx total cell index
+                     * @param currentStep current time step, unused
+                     */
+                    HDINLINE typename T_DataBox::ValueType operator()(
+                        DataSpace<simDim> const& cellIdx,
+                        uint32_t const currentStep) const
+                    {
+                        return cacheBox(cellIdx - originCellIdx);
+                    }
+
+                private:
+                    PMACC_ALIGN(cacheBox, T_DataBox);
+                    PMACC_ALIGN(originCellIdx, DataSpace<simDim>);
+                };
+
                 /* Implementation of background application to the given field
                  *
                  * @tparam T_Field field affected, e.g. picongpu::FieldE
@@ -72,15 +136,23 @@ namespace picongpu
                         , useDuplicateField(useDuplicateField)
                         , restoreFromDuplicateField(false)
                         , isEnabled(FieldBackground::InfluenceParticlePusher)
+                        , useCache(isEnabled && IsTimeIndependent<FieldBackground>::value)
+                        , isCacheValid(false)
+                        , cacheSlideCounter(0u)
                     {
+                        DataConnector& dc = Environment<>::get().DataConnector();
+                        auto field = dc.get<Field>(Field::getName(), true);
+                        auto const& gridBuffer = field->getGridBuffer();
                         if(isEnabled && useDuplicateField)
                         {
                             // Allocate a duplicate field buffer and copy the values
-                            DataConnector& dc = Environment<>::get().DataConnector();
-                            auto field = dc.get<Field>(Field::getName(), true);
-                            auto const& gridBuffer = field->getGridBuffer();
                             duplicateBuffer = pmacc::makeDeepCopy(gridBuffer.getDeviceBuffer());
                         }
+                        if(useCache)
+                        {
+                            // Allocate a buffer for the background values, filled on first use
+                            cacheBuffer = pmacc::makeDeepCopy(gridBuffer.getDeviceBuffer());
+                        }
                     }
 
                     /** Add the field background in the whole local domain
@@ -100,7 +172,10 @@ namespace picongpu
                             duplicateBuffer->copyFrom(gridBuffer.getDeviceBuffer());
                             restoreFromDuplicateField = true;
                         }
-                        apply(step, pmacc::math::operation::Add(), field);
+                        if(useCache)
+                            applyCached(step, pmacc::math::operation::Add(), field);
+                        else
+                            apply(step, pmacc::math::operation::Add(), field);
                     }
 
                     /** Subtract the field background in the whole local domain
@@ -123,6 +198,8 @@ namespace picongpu
                             gridBuffer.getDeviceBuffer().copyFrom(*duplicateBuffer);
                             restoreFromDuplicateField = false;
                         }
+                        else if(useCache)
+                            applyCached(step, pmacc::math::operation::Sub(), field);
                         else
                             apply(step, pmacc::math::operation::Sub(), field);
                     }
@@ -137,12 +214,24 @@ namespace picongpu
                     //! Flag to restore from the duplicate field: true if it is enabled and up-to-date
                     bool restoreFromDuplicateField;
 
+                    //! Is the background time-independent and its values are precomputed once
+                    bool useCache;
+
+                    //! Flag if the precomputed background values are up-to-date
+                    bool isCacheValid;
+
+                    //! Number of moving window slides at the time the background values were precomputed
+                    uint32_t cacheSlideCounter;
+
                     //! Buffer type to store duplicated values
                     using DeviceBuffer = typename Field::Buffer::DBuffer;
 
                     //! Buffer to store duplicated values, only used when useDuplicateField is true
                     std::unique_ptr<DeviceBuffer> duplicateBuffer;
 
+                    //! Buffer to store precomputed background values, only used when useCache is true
+                    std::unique_ptr<DeviceBuffer> cacheBuffer;
+
                     //! Mapping for kernels
                     MappingDesc const cellDescription;
 
@@ -162,6 +251,47 @@ namespace picongpu
                         CallBackground callBackground(cellDescription);
                         callBackground(&field, functor, FieldBackground(field.getUnit()), step);
                     }
+
+                    /** Apply the given functor to the precomputed field background in the whole local domain
+                     *
+                     * The background values are computed once and again only after the moving window slided.
+                     *
+                     * @tparam T_Functor functor type compatible to pmacc::math::operation
+                     *
+                     * @param step index of time iteration
+                     * @param functor functor to apply
+                     * @param field field object which data is modified
+                     */
+                    template<typename T_Functor>
+                    void applyCached(uint32_t const step, T_Functor functor, Field& field)
+                    {
+                        constexpr auto area = CORE + BORDER + GUARD;
+                        using CallBackground = cellwiseOperation::CellwiseOperation<area>;
+                        CallBackground callBackground(cellDescription);
+
+                        uint32_t const slideCounter = MovingWindow::getInstance().getSlideCounter(step);
+                        if(!isCacheValid || slideCounter != cacheSlideCounter)
+                        {
+                            callBackground.applyToBox(
+                                cacheBuffer->getDataBox(),
+                                pmacc::math::operation::Assign(),
+                                FieldBackground(field.getUnit()),
+                                step);
+                            isCacheValid = true;
+                            cacheSlideCounter = slideCounter;
+                        }
+
+                        DataSpace<simDim> const guardCells
+                            = cellDescription.getGuardingSuperCells() * SuperCellSize::toRT();
+                        DataSpace<simDim> const originCellIdx
+                            = CallBackground::getTotalDomainOffset(step) - guardCells;
+                        auto const cacheBox = cacheBuffer->getDataBox();
+                        callBackground(
+                            &field,
+                            functor,
+                            CachedFieldBackground<decltype(cacheBox)>(cacheBox, originCellIdx),
+                            step);
+                    }
                 };
             } // namespace detail
 
@@ -53,13 +53,15 @@ namespace picongpu
                 /** Ionize particles
                  *
                  * @param step index of time iteration
+                 * @param skipMergedSpecies skip species whose ionization is merged into the push,
+                 *                          see particles::ionization::CanMergeIntoPush
                  */
-                void operator()(uint32_t const step) const
+                void operator()(uint32_t const step, bool const skipMergedSpecies = false) const
                 {
                     using pmacc::particles::traits::FilterByFlag;
                     using SpeciesWithIonizers = typename FilterByFlag<VectorAllSpecies, ionizers<>>::type;
                     pmacc::meta::ForEach<SpeciesWithIonizers, particles::CallIonization<bmpl::_1>> particleIonization;
-                    particleIonization(cellDescription, step);
+                    particleIonization(cellDescription, step, skipMergedSpecies);
                 }
 
             private:
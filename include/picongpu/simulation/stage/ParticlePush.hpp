@@ -22,8 +22,14 @@
 #pragma once
 
 #include "picongpu/particles/ParticlesFunctors.hpp"
+#include "picongpu/particles/traits/CanFuseCurrentDeposition.hpp"
 
 #include <pmacc/eventSystem/Manager.hpp>
+#include <pmacc/meta/ForEach.hpp>
+#include <pmacc/particles/traits/FilterByFlag.hpp>
+
+#include <boost/mpl/empty.hpp>
+#include <boost/program_options/options_description.hpp>
 
 #include <cstdint>
 
@@ -34,9 +40,75 @@ namespace picongpu
     {
         namespace stage
         {
+            namespace detail
+            {
+                //! Log where the current of a species with a pusher and a current solver is deposited
+                template<typename T_SpeciesType>
+                struct LogCurrentDepositionFusion
+                {
+                    using SpeciesType = T_SpeciesType;
+                    using FrameType = typename SpeciesType::FrameType;
+
+                    HINLINE void operator()() const
+                    {
+                        if(particles::traits::CanFuseCurrentDeposition<SpeciesType>::type::value)
+                            log<picLog::PHYSICS>("particlePush: species %1% deposits its current within the push")
+                                % FrameType::getName();
+                        else
+                            log<picLog::PHYSICS>(
+                                "particlePush: species %1% deposits its current separately, its E, B and J caches "
+                                "do not fit into shared memory or its current solver writes outside of its margins")
+                                % FrameType::getName();
+                    }
+                };
+
+            } // namespace detail
+
             //! Functor for the stage of the PIC loop performing particle push
-            struct ParticlePush
+            class ParticlePush
             {
+            public:
+                /** Register program options for the particle push
+                 *
+                 * @param desc program options following boost::program_options::options_description
+                 */
+                void registerHelp(po::options_description& desc)
+                {
+                    desc.add_options()(
+                        "particlePush.fuseCurrentDeposition",
+                        po::value<bool>(&fuseCurrentDeposition)->zero_tokens(),
+                        "deposit the current of species with a pusher and a current solver within the push kernel "
+                        "to read the particle data only once, the current deposition stage skips these species, "
+                        "species whose E, B and J caches do not fit into shared memory are deposited separately")(
+                        "particlePush.overlapCommunication",
+                        po::value<bool>(&overlapCommunication)->zero_tokens(),
+                        "push the border supercells first and send the particles leaving the local domain while "
+                        "the core is pushed, not used for species with an offset of an outer boundary")(
+                        "particlePush.mergeFieldIonization",
+                        po::value<bool>(&mergeFieldIonization)->zero_tokens(),
+                        "ionize species with a single field ionizer in the push kernel to load E and B only once, "
+                        "the ionization stage skips these species and they deposit their current separately, "
+                        "ignored if any species uses population kinetics, synchrotron photons or bremsstrahlung");
+                }
+
+                /** Initialize the particle push stage
+                 *
+                 * Reports for each species with a current solver if its current deposition is fused into the
+                 * push, in case this was requested.
+                 */
+                void init() const
+                {
+                    if(!fuseCurrentDeposition)
+                        return;
+
+                    using pmacc::particles::traits::FilterByFlag;
+                    using SpeciesWithPusher = typename FilterByFlag<VectorAllSpecies, particlePusher<>>::type;
+                    using SpeciesWithPusherAndCurrent = typename FilterByFlag<SpeciesWithPusher, current<>>::type;
+                    pmacc::meta::ForEach<SpeciesWithPusherAndCurrent, detail::LogCurrentDepositionFusion<bmpl::_1>>
+                        logCurrentDepositionFusion;
+                    logCurrentDepositionFusion();
+                }
+
                 /** Push all particle species
                  *
                  * @param step index of time iteration
@@ -47,9 +119,57 @@ namespace picongpu
                     pmacc::EventTask initEvent = __getTransactionEvent();
                     pmacc::EventTask updateEvent;
                     particles::PushAllSpecies pushAllSpecies;
-                    pushAllSpecies(step, initEvent, updateEvent, commEvent);
+                    pushAllSpecies(
+                        step,
+                        initEvent,
+                        updateEvent,
+                        commEvent,
+                        fuseCurrentDeposition,
+                        overlapCommunication,
+                        isFieldIonizationMerged());
                     __setTransactionEvent(updateEvent);
                 }
+
+                //! @return true if species with a pusher deposit their current within the push
+                bool isCurrentDepositionFused() const
+                {
+                    return fuseCurrentDeposition;
+                }
+
+                /** Check if the field ionization of species supporting it is done within the push
+                 *
+                 * Electrons created within the push would miss the population kinetics, synchrotron radiation
+                 * and bremsstrahlung stages of the time step, therefore the merge is only done if no species
+                 * uses one of these stages.
+                 */
+                bool isFieldIonizationMerged() const
+                {
+                    return mergeFieldIonization && !hasStagesAfterIonization();
+                }
+
+            private:
+                //! @return true if a particle stage between the ionization and the push has any species
+                static bool hasStagesAfterIonization()
+                {
+                    using pmacc::particles::traits::FilterByFlag;
+                    using FlyLiteIons = typename FilterByFlag<VectorAllSpecies, populationKinetics<>>::type;
+                    using SynchrotronSpecies = typename FilterByFlag<VectorAllSpecies, synchrotronPhotons<>>::type;
+                    bool hasStages = !bmpl::empty<FlyLiteIons>::value || !bmpl::empty<SynchrotronSpecies>::value;
+#if(PMACC_CUDA_ENABLED == 1)
+                    using BremsstrahlungIons = typename FilterByFlag<VectorAllSpecies, bremsstrahlungIons<>>::type;
+                    hasStages = hasStages || !bmpl::empty<BremsstrahlungIons>::value;
+#endif
+                    return hasStages;
+                }
+
+                //! Set by program option
+                bool fuseCurrentDeposition = false;
+
+                //! Set by program option
+                bool overlapCommunication = false;
+
+                //! Set by program option
+                bool mergeFieldIonization = false;
             };
 
         } // namespace stage
@@ -0,0 +1,100 @@
+/* Copyright 2021 PIConGPU contributors
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "picongpu/simulation_defines.hpp"
+
+#include <pmacc/Environment.hpp>
+#include <pmacc/dataManagement/DataConnector.hpp>
+#include <pmacc/mappings/kernel/AreaMapping.hpp>
+#include <pmacc/meta/ForEach.hpp>
+#include <pmacc/type/Area.hpp>
+
+#include <boost/program_options/options_description.hpp>
+
+#include <cstdint>
+
+
+namespace picongpu
+{
+    namespace simulation
+    {
+        namespace stage
+        {
+            namespace detail
+            {
+                template<typename T_SpeciesType>
+                struct SortParticles
+                {
+                    using SpeciesType = T_SpeciesType;
+                    using FrameType = typename SpeciesType::FrameType;
+
+                    HINLINE void operator()(pmacc::DataConnector& dc) const
+                    {
+                        auto species = dc.get<SpeciesType>(FrameType::getName(), true);
+                        species->sortParticles(pmacc::AreaMapperFactory<pmacc::type::CORE + pmacc::type::BORDER>{});
+                    }
+                };
+
+            } // namespace detail
+
+            /** Functor for the stage of the PIC loop sorting particles within supercells
+             *
+             * Particles of all species are periodically ordered by their cell index and re-packed into newly
+             * allocated frames to restore the memory locality of the particle data.
+             */
+            class ParticleSort
+            {
+            public:
+                /** Register program options for the particle sorting
+                 *
+                 * @param desc program options following boost::program_options::options_description
+                 */
+                void registerHelp(po::options_description& desc)
+                {
+                    desc.add_options()(
+                        "particleSort.period",
+                        po::value<uint32_t>(&period)->default_value(0u),
+                        "sort particles of all species within each supercell by their cell index every n-th time "
+                        "step, 0 disables sorting");
+                }
+
+                /** Sort particles of all species
+                 *
+                 * @param step index of time iteration
+                 */
+                void operator()(uint32_t const step) const
+                {
+                    if(period == 0u || step % period != 0u)
+                        return;
+
+                    pmacc::DataConnector& dc = pmacc::Environment<>::get().DataConnector();
+                    pmacc::meta::ForEach<VectorAllSpecies, detail::SortParticles<bmpl::_1>> sortParticles;
+                    sortParticles(dc);
+                }
+
+            private:
+                //! Set by program option
+                uint32_t period = 0u;
+            };
+
+        } // namespace stage
+    } // namespace simulation
+} // namespace picongpu
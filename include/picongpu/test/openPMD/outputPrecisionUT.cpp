@@ -0,0 +1,161 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "picongpu/plugins/openPMD/OutputPrecision.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+
+#include <catch2/catch.hpp>
+
+
+namespace
+{
+    //! bit pattern of a float
+    uint32_t toBits(float const value)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        return bits;
+    }
+} // namespace
+
+TEST_CASE("openPMD::roundMantissa", "[openPMD]")
+{
+    using picongpu::openPMD::roundMantissa;
+
+    constexpr float one = 1.0f;
+    // distance of two values with 10 explicitly stored mantissa bits in [1;2)
+    float const ulp10 = std::ldexp(1.0f, -10);
+
+    SECTION("all bits are kept for 0 and at least the stored mantissa bits")
+    {
+        float const value = 1.0f + std::ldexp(1.0f, -23);
+        CHECK(roundMantissa(value, 0u) == value);
+        CHECK(roundMantissa(value, 23u) == value);
+        CHECK(roundMantissa(value, 64u) == value);
+        double const value64 = 1.0 + std::ldexp(1.0, -52);
+        CHECK(roundMantissa(value64, 52u) == value64);
+    }
+
+    SECTION("round half to even")
+    {
+        // ties go to the value with an even lowest kept bit
+        CHECK(roundMantissa(one + 0.5f * ulp10, 10u) == one);
+        CHECK(roundMantissa(one + 1.5f * ulp10, 10u) == one + 2.0f * ulp10);
+        CHECK(roundMantissa(-(one + 1.5f * ulp10), 10u) == -(one + 2.0f * ulp10));
+        // values next to a tie are rounded to nearest
+        CHECK(roundMantissa(one + 0.5f * ulp10 + std::ldexp(1.0f, -23), 10u) == one + ulp10);
+        CHECK(roundMantissa(one + 0.5f * ulp10 - std::ldexp(1.0f, -23), 10u) == one);
+        // the carry into the exponent gives the next power of two
+        CHECK(roundMantissa(2.0f - std::ldexp(1.0f, -23), 10u) == 2.0f);
+    }
+
+    SECTION("bit limits")
+    {
+        // a single dropped bit
+        float const ulp22 = std::ldexp(1.0f, -22);
+        CHECK(roundMantissa(one + 0.5f * ulp22, 22u) == one);
+        CHECK(roundMantissa(one + 1.5f * ulp22, 22u) == one + 2.0f * ulp22);
+        // a single kept bit
+        CHECK(roundMantissa(1.25f, 1u) == 1.0f);
+        CHECK(roundMantissa(1.75f, 1u) == 2.0f);
+        CHECK(roundMantissa(1.5f, 1u) == 1.5f);
+    }
+
+    SECTION("denormals")
+    {
+        float const minDenormal = std::numeric_limits<float>::denorm_min();
+        // the distance of two denormals with 10 kept mantissa bits is 2^13 times the smallest denormal
+        float const quantum = std::ldexp(minDenormal, 13);
+        CHECK(roundMantissa(minDenormal, 10u) == 0.0f);
+        CHECK(roundMantissa(0.5f * quantum, 10u) == 0.0f);
+        CHECK(roundMantissa(1.5f * quantum, 10u) == 2.0f * quantum);
+        // the largest denormal is rounded up to the smallest normal value
+        float const maxDenormal = std::numeric_limits<float>::min() - minDenormal;
+        CHECK(roundMantissa(maxDenormal, 10u) == std::numeric_limits<float>::min());
+        CHECK(toBits(roundMantissa(-0.0f, 10u)) == toBits(-0.0f));
+    }
+
+    SECTION("infinity and NaN are kept")
+    {
+        float const inf = std::numeric_limits<float>::infinity();
+        CHECK(roundMantissa(inf, 10u) == inf);
+        CHECK(roundMantissa(-inf, 10u) == -inf);
+        float const nan = std::numeric_limits<float>::quiet_NaN();
+        CHECK(toBits(roundMantissa(nan, 10u)) == toBits(nan));
+        // rounding up the largest finite value overflows like any round to nearest
+        CHECK(roundMantissa(std::numeric_limits<float>::max(), 10u) == inf);
+    }
+
+    SECTION("non floating point values are kept")
+    {
+        CHECK(roundMantissa(uint32_t{0xffffffffu}, 10u) == uint32_t{0xffffffffu});
+        CHECK(roundMantissa(int64_t{-12345}, 1u) == int64_t{-12345});
+    }
+
+    SECTION("23 bits of a double are rounded like a cast to float")
+    {
+        std::mt19937 engine(42u);
+        std::uniform_real_distribution<double> mantissa(1.0, 2.0);
+        std::uniform_int_distribution<int> exponent(-120, 120);
+        for(uint32_t i = 0u; i < 10000u; ++i)
+        {
+            double const value = std::ldexp(mantissa(engine), exponent(engine));
+            CHECK(roundMantissa(value, 23u) == static_cast<double>(static_cast<float>(value)));
+        }
+    }
+}
+
+TEST_CASE("openPMD::quantizePosition", "[openPMD]")
+{
+    using picongpu::openPMD::quantizePosition;
+
+    CHECK(quantizePosition<uint8_t>(0.0f, 8u) == 0u);
+    CHECK(quantizePosition<uint8_t>(0.5f, 8u) == 128u);
+    // round to nearest, ties away from zero
+    CHECK(quantizePosition<uint8_t>(0.375f, 2u) == 2u);
+    CHECK(quantizePosition<uint8_t>(0.3f, 2u) == 1u);
+    // positions rounding to the next cell are clamped to the largest value
+    CHECK(quantizePosition<uint8_t>(0.999f, 8u) == 255u);
+    CHECK(quantizePosition<uint32_t>(std::nextafter(1.0, 0.0), 32u) == 0xffffffffu);
+    // the largest float below one is exactly representable with 32 bits
+    CHECK(quantizePosition<uint32_t>(std::nextafter(1.0f, 0.0f), 32u) == 0xffffff00u);
+    // negative values are clamped to zero
+    CHECK(quantizePosition<uint16_t>(-1.0e-7f, 16u) == 0u);
+    CHECK(quantizePosition<uint8_t>(0.75, 1u) == 1u);
+
+    // the dequantized position differs at most half a quantum from the position
+    std::mt19937 engine(42u);
+    std::uniform_real_distribution<double> position(0.0, 1.0);
+    for(uint32_t bits = 1u; bits <= 32u; ++bits)
+    {
+        double const quantum = std::ldexp(1.0, -static_cast<int>(bits));
+        for(uint32_t i = 0u; i < 1000u; ++i)
+        {
+            double const value = position(engine);
+            double const dequantized = static_cast<double>(quantizePosition<uint32_t>(value, bits)) * quantum;
+            CHECK(std::abs(dequantized - std::min(value, 1.0 - quantum)) <= 0.5 * quantum);
+        }
+    }
+}
@@ -0,0 +1,160 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PIConGPU.
+ *
+ * PIConGPU is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PIConGPU is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with PIConGPU.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pmacc/boost_workaround.hpp>
+
+#include "picongpu/simulation_defines.hpp"
+
+#include "picongpu/plugins/radiation/nufft.hpp"
+
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/memory/buffers/HostDeviceBuffer.hpp>
+#include <pmacc/test/PMaccFixture.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <catch2/catch.hpp>
+
+
+namespace picongpu
+{
+    namespace test
+    {
+        namespace radiation
+        {
+            using namespace picongpu::plugins::radiation;
+
+            //! number of values per sample: retarded time and the three amplitude components
+            constexpr uint32_t valuesPerSample = 4u;
+
+            //! spread all samples to the grid of observer 0, a single thread keeps the test deterministic
+            struct SpreadSamples
+            {
+                template<typename T_SampleBox, typename T_GridBox, typename T_Acc>
+                DINLINE void operator()(
+                    T_Acc const& acc,
+                    T_SampleBox const samples,
+                    uint32_t const numSamples,
+                    NufftGrid const nufftGrid,
+                    T_GridBox const grid) const
+                {
+                    for(uint32_t s = 0u; s < numSamples; ++s)
+                    {
+                        uint32_t const idx = s * valuesPerSample;
+                        vector_64 const amplitude(samples(idx + 1u), samples(idx + 2u), samples(idx + 3u));
+                        nufftGrid.spread(acc, grid, 0, amplitude, samples(idx));
+                    }
+                }
+            };
+
+            /** Compare the NUFFT with the direct sum over all samples
+             *
+             * @param numFrequencies number of frequencies
+             * @param omegaMin lowest frequency
+             * @param deltaOmega difference between two frequencies
+             * @param tMax retarded times are uniformly distributed in [0, tMax)
+             * @return largest deviation of an amplitude component relative to the largest amplitude component
+             */
+            HINLINE float_64 relativeDeviation(
+                uint32_t const numFrequencies,
+                float_64 const omegaMin,
+                float_64 const deltaOmega,
+                float_64 const tMax)
+            {
+                constexpr uint32_t numSamples = 300u;
+
+                pmacc::HostDeviceBuffer<float_64, 1> samples(numSamples * valuesPerSample);
+                auto samplesBox = samples.getHostBuffer().getDataBox();
+                std::mt19937 engine(42u);
+                std::uniform_real_distribution<float_64> time(0.0, tMax);
+                std::uniform_real_distribution<float_64> amplitude(-1.0, 1.0);
+                for(uint32_t s = 0u; s < numSamples; ++s)
+                {
+                    samplesBox(s * valuesPerSample) = time(engine);
+                    for(uint32_t d = 1u; d < valuesPerSample; ++d)
+                        samplesBox(s * valuesPerSample + d) = amplitude(engine);
+                }
+                samples.hostToDevice();
+
+                NufftGrid const nufftGrid(numFrequencies, omegaMin, deltaOmega);
+                pmacc::GridBuffer<float_64, 2> grid(
+                    DataSpace<2>(nufftGrid.getNumPoints() * NufftGrid::valuesPerPoint, 1));
+                grid.getDeviceBuffer().setValue(0.0);
+                PMACC_KERNEL(SpreadSamples{})
+                (1, 1)(samples.getDeviceBuffer().getDataBox(),
+                       numSamples,
+                       nufftGrid,
+                       grid.getDeviceBuffer().getDataBox());
+                grid.deviceToHost();
+
+                std::vector<Amplitude<>> amplitudes(numFrequencies);
+                nufftGrid.transform(grid.getHostBuffer().getDataBox(), 0, amplitudes.data());
+
+                float_64 maxDeviation = 0.0;
+                float_64 maxValue = 0.0;
+                for(uint32_t o = 0u; o < numFrequencies; ++o)
+                {
+                    float_64 const omega = omegaMin + float_64(o) * deltaOmega;
+                    std::complex<float_64> reference[3];
+                    for(uint32_t s = 0u; s < numSamples; ++s)
+                    {
+                        uint32_t const idx = s * valuesPerSample;
+                        std::complex<float_64> const phase = std::polar(1.0, omega * samplesBox(idx));
+                        for(uint32_t d = 0u; d < 3u; ++d)
+                            reference[d] += samplesBox(idx + 1u + d) * phase;
+                    }
+                    Amplitude<>::complex_T const nufft[3]
+                        = {amplitudes[o].getXcomponent(),
+                           amplitudes[o].getYcomponent(),
+                           amplitudes[o].getZcomponent()};
+                    for(uint32_t d = 0u; d < 3u; ++d)
+                    {
+                        std::complex<float_64> const value(nufft[d].get_real(), nufft[d].get_imag());
+                        maxDeviation = std::max(maxDeviation, std::abs(value - reference[d]));
+                        maxValue = std::max(maxValue, std::abs(reference[d]));
+                    }
+                }
+                return maxDeviation / maxValue;
+            }
+
+        } // namespace radiation
+    } // namespace test
+} // namespace picongpu
+
+TEST_CASE("radiation::NufftGrid", "[radiation]")
+{
+    using namespace picongpu::test::radiation;
+
+    pmacc::test::PMaccFixture<picongpu::simDim> fixture;
+
+    // the documented accuracy of the NUFFT with 12 grid points on each side of a sample
+    constexpr picongpu::float_64 tolerance = 1.0e-11;
+
+    // number of frequencies is a power of two, oversampling by two
+    CHECK(relativeDeviation(512u, 1.0, 0.01, 3000.0) < tolerance);
+    // number of frequencies is not a power of two, oversampling by more than two
+    CHECK(relativeDeviation(300u, 0.5, 0.02, 500.0) < tolerance);
+    // retarded times spanning several periods of the grid
+    CHECK(relativeDeviation(128u, 2.0, 0.1, 1.0e4) < tolerance);
+}
@@ -24,6 +24,7 @@
 
 #include "pmacc/Environment.def"
 #include "pmacc/assert.hpp"
+#include "pmacc/communication/ExchangeAggregator.hpp"
 #include "pmacc/communication/manager_common.hpp"
 #include "pmacc/dataManagement/DataConnector.hpp"
 #include "pmacc/device/MemoryInfo.hpp"
@@ -69,8 +70,16 @@ namespace pmacc
             /** state if the SubGrid is defined */
             bool m_isSubGridDefined{false};
 
-            /** state shows if MPI direct is activated */
+            /** state shows if MPI direct is activated
+             *
+             * Accelerators without own device memory always communicate directly from the device buffers, staging
+             * the exchanges through host buffers would only add two copies.
+             */
+#if(PMACC_CUDA_ENABLED == 1 || ALPAKA_ACC_GPU_HIP_ENABLED == 1)
             bool m_isMpiDirectEnabled{false};
+#else
+            bool m_isMpiDirectEnabled{true};
+#endif
 
             /** get the singleton EnvironmentContext
              *
@@ -130,6 +139,10 @@ namespace pmacc
             void enableMpiDirect()
             {
                 m_isMpiDirectEnabled = true;
+#if(PMACC_EXCHANGE_AGGREGATION == 1 && (PMACC_CUDA_ENABLED == 1 || ALPAKA_ACC_GPU_HIP_ENABLED == 1))
+                // device memory can not be copied into an aggregated message
+                communication::ExchangeAggregator::get().disablePacking();
+#endif
             }
 
             //! query if MPI direct support is activated
@@ -406,7 +419,13 @@ namespace pmacc
             m_isMpiInitialized = true;
 
             // MPI_Init with NULL is allowed since MPI 2.0
+#if(PMACC_MPI_THREAD_MULTIPLE == 1)
+            // the provided level is checked by the users of threaded MPI via MPI_Query_thread
+            int provided = MPI_THREAD_SINGLE;
+            MPI_CHECK(MPI_Init_thread(nullptr, nullptr, MPI_THREAD_MULTIPLE, &provided));
+#else
             MPI_CHECK(MPI_Init(nullptr, nullptr));
+#endif
         }
 
         void EnvironmentContext::finalize()
@@ -414,6 +433,9 @@ namespace pmacc
             if(m_isMpiInitialized)
             {
                 pmacc::Environment<>::get().Manager().waitForAllTasks();
+#if(PMACC_EXCHANGE_AGGREGATION == 1)
+                communication::ExchangeAggregator::get().finalize();
+#endif
                 // Required by scorep for flushing the buffers
                 cuplaDeviceSynchronize();
                 m_isMpiInitialized = false;
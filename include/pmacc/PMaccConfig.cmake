@@ -394,6 +394,24 @@ if(PMACC_BLOCKING_KERNEL)
     set(PMacc_DEFINITIONS ${PMacc_DEFINITIONS} "-DPMACC_SYNC_KERNEL=1")
 endif(PMACC_BLOCKING_KERNEL)
 
+option(PMACC_SIMD_FRAME_LAYOUT
+    "align particle frame attributes to the SIMD width on CPU accelerators" OFF)
+if(PMACC_SIMD_FRAME_LAYOUT)
+    set(PMacc_DEFINITIONS ${PMacc_DEFINITIONS} "-DPMACC_SIMD_FRAME_LAYOUT=1")
+endif(PMACC_SIMD_FRAME_LAYOUT)
+
+option(PMACC_MPI_THREAD_MULTIPLE
+    "initialize MPI with MPI_THREAD_MULTIPLE to allow MPI calls from background threads" OFF)
+if(PMACC_MPI_THREAD_MULTIPLE)
+    set(PMacc_DEFINITIONS ${PMacc_DEFINITIONS} "-DPMACC_MPI_THREAD_MULTIPLE=1")
+endif(PMACC_MPI_THREAD_MULTIPLE)
+
+option(PMACC_EXCHANGE_AGGREGATION
+    "pack all small exchange buffers sent to the same neighbor rank into one MPI message" OFF)
+if(PMACC_EXCHANGE_AGGREGATION)
+    set(PMacc_DEFINITIONS ${PMacc_DEFINITIONS} "-DPMACC_EXCHANGE_AGGREGATION=1")
+endif(PMACC_EXCHANGE_AGGREGATION)
+
 set(PMACC_VERBOSE "0" CACHE STRING "set verbose level for PMacc")
 set(PMacc_DEFINITIONS ${PMacc_DEFINITIONS} "-DPMACC_VERBOSE_LVL=${PMACC_VERBOSE}")
 
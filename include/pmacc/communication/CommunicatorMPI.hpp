@@ -22,6 +22,7 @@
 
 #pragma once
 
+#include "pmacc/communication/ExchangeAggregator.hpp"
 #include "pmacc/communication/ICommunicator.hpp"
 #include "pmacc/communication/manager_common.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
@@ -161,6 +162,9 @@ namespace pmacc
             MPI_CHECK(MPI_Cart_create(computing_comm, DIM, dims, periods, 0, &topology));
             // create communicator for signal handling
             MPI_CHECK(MPI_Comm_dup(topology, &commSignal));
+#if(PMACC_EXCHANGE_AGGREGATION == 1)
+            communication::ExchangeAggregator::get().init(topology);
+#endif
 
             // 3. update Host rank
             updateHostRank();
@@ -200,6 +204,10 @@ namespace pmacc
 
         MPI_Request* startSend(uint32_t ex, const char* send_data, size_t send_data_count, uint32_t tag) override
         {
+#if(PMACC_EXCHANGE_AGGREGATION == 1)
+            return communication::ExchangeAggregator::get()
+                .startSend(ExchangeTypeToRank(ex), send_data, send_data_count, gridExchangeTag + tag);
+#else
             auto* request = new MPI_Request;
 
             MPI_CHECK(MPI_Isend(
@@ -212,12 +220,17 @@ namespace pmacc
                 request));
 
             return request;
+#endif
         }
 
         // description in ICommunicator
 
         MPI_Request* startReceive(uint32_t ex, char* recv_data, size_t recv_data_max, uint32_t tag) override
         {
+#if(PMACC_EXCHANGE_AGGREGATION == 1)
+            return communication::ExchangeAggregator::get()
+                .startReceive(ExchangeTypeToRank(ex), recv_data, recv_data_max, gridExchangeTag + tag);
+#else
             auto* request = new MPI_Request;
 
             MPI_CHECK(MPI_Irecv(
@@ -230,6 +243,7 @@ namespace pmacc
                 request));
 
             return request;
+#endif
         }
 
         // description in ICommunicator
@@ -0,0 +1,425 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/communication/manager_common.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <list>
+#include <map>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <mpi.h>
+
+
+namespace pmacc
+{
+    namespace communication
+    {
+        /** Packs the exchange messages sent to the same neighbor rank into one MPI message
+         *
+         * Messages passed to startSend() are queued per destination rank and are sent as one aggregated message
+         * with the next call of progress(), which is triggered each time the event system polls its tasks.
+         * Messages larger than maxAggregatedBytes are not copied: they are sent directly and only announced by an
+         * entry in the aggregated message. If packing is disabled, e.g. because the messages are located in device
+         * memory, all messages are sent this way.
+         *
+         * The requests returned by startSend() and startReceive() are MPI generalized requests, they can be
+         * tested with MPI_Test and queried with MPI_Get_count like the requests of point-to-point operations.
+         */
+        class ExchangeAggregator
+        {
+        public:
+            //! messages larger than this are sent without copying them into the aggregated message
+            static constexpr size_t maxAggregatedBytes = 64u * 1024u;
+
+            static ExchangeAggregator& get()
+            {
+                static ExchangeAggregator instance;
+                return instance;
+            }
+
+            /** initialize the aggregator
+             *
+             * @param comm communicator of the exchanges, the aggregator uses a duplicate of it
+             */
+            void init(MPI_Comm comm)
+            {
+                MPI_CHECK(MPI_Comm_dup(comm, &aggregationComm));
+            }
+
+            /** wait until all aggregated messages are delivered and release the communicator
+             *
+             * Must be called collectively before MPI is finalized.
+             */
+            void finalize()
+            {
+                if(aggregationComm == MPI_COMM_NULL)
+                    return;
+
+                progress();
+                while(!inFlightSends.empty() || !directTransfers.empty())
+                    progress();
+
+                MPI_CHECK(MPI_Comm_free(&aggregationComm));
+            }
+
+            /** send all messages directly instead of copying them into the aggregated message
+             *
+             * Must be called if the message data is not accessible by the host.
+             */
+            void disablePacking()
+            {
+                isPackingEnabled = false;
+            }
+
+            /** queue a message for a neighbor rank
+             *
+             * @param rank destination rank in the exchange communicator
+             * @param data message data, must be valid until the returned request is finished
+             * @param numBytes size of the message in bytes
+             * @param tag message tag
+             * @return request which is finished as soon as data can be reused
+             */
+            MPI_Request* startSend(int rank, const char* data, size_t numBytes, int tag)
+            {
+                auto* state = new RequestState{numBytes, rank, tag};
+                auto* request = new MPI_Request;
+                MPI_CHECK(MPI_Grequest_start(queryRequest, freeRequest, cancelRequest, state, request));
+
+                bool const isDirect = !isPackingEnabled || numBytes > maxAggregatedBytes;
+                if(isDirect)
+                {
+                    MPI_Request transfer;
+                    MPI_CHECK(MPI_Isend(
+                        (void*) data,
+                        static_cast<int>(numBytes),
+                        MPI_CHAR,
+                        rank,
+                        tag,
+                        aggregationComm,
+                        &transfer));
+                    directTransfers.push_back(DirectTransfer{transfer, *request});
+                }
+                sendQueues[rank].push_back(QueuedSend{tag, isDirect, data, numBytes, *request});
+
+                return request;
+            }
+
+            /** register a receive for a message from a neighbor rank
+             *
+             * @param rank source rank in the exchange communicator
+             * @param data destination buffer
+             * @param maxBytes size of the destination buffer in bytes
+             * @param tag message tag
+             * @return request which is finished as soon as the message is stored in data
+             */
+            MPI_Request* startReceive(int rank, char* data, size_t maxBytes, int tag)
+            {
+                auto* state = new RequestState{0u, rank, tag};
+                auto* request = new MPI_Request;
+                MPI_CHECK(MPI_Grequest_start(queryRequest, freeRequest, cancelRequest, state, request));
+
+                PostedReceive receive{data, maxBytes, *request, state};
+                auto const key = std::make_pair(rank, tag);
+                auto unexpected = unexpectedMessages.find(key);
+                if(unexpected != unexpectedMessages.end() && !unexpected->second.empty())
+                {
+                    UnexpectedMessage& message = unexpected->second.front();
+                    deliver(receive, rank, tag, message.isDirect, message.numBytes, message.payload.data());
+                    unexpected->second.pop_front();
+                }
+                else
+                    postedReceives[key].push_back(receive);
+
+                return request;
+            }
+
+            /** send all queued messages and handle incoming aggregated messages */
+            void progress()
+            {
+                if(aggregationComm == MPI_COMM_NULL)
+                    return;
+
+                flushSendQueues();
+                receiveAggregatedMessages();
+                testRequests();
+            }
+
+        private:
+            //! tag of the aggregated messages, exchange tags are always larger
+            static constexpr int aggregationTag = 0;
+
+            //! extra state of a generalized request
+            struct RequestState
+            {
+                size_t numBytes;
+                int source;
+                int tag;
+            };
+
+            //! header of a single message within an aggregated message
+            struct EntryHeader
+            {
+                uint64_t numBytes;
+                int32_t tag;
+                int32_t isDirect;
+            };
+
+            struct QueuedSend
+            {
+                int tag;
+                bool isDirect;
+                const char* data;
+                size_t numBytes;
+                MPI_Request request;
+            };
+
+            struct PostedReceive
+            {
+                char* data;
+                size_t maxBytes;
+                MPI_Request request;
+                RequestState* state;
+            };
+
+            struct UnexpectedMessage
+            {
+                bool isDirect;
+                size_t numBytes;
+                std::vector<char> payload;
+            };
+
+            //! MPI transfer of a message which is not aggregated and the request handed out for it
+            struct DirectTransfer
+            {
+                MPI_Request transfer;
+                MPI_Request request;
+            };
+
+            struct InFlightSend
+            {
+                MPI_Request transfer;
+                std::vector<char> buffer;
+            };
+
+            ExchangeAggregator() = default;
+
+            static int queryRequest(void* extraState, MPI_Status* status)
+            {
+                auto* state = static_cast<RequestState*>(extraState);
+                MPI_Status_set_elements(status, MPI_CHAR, static_cast<int>(state->numBytes));
+                MPI_Status_set_cancelled(status, 0);
+                status->MPI_SOURCE = state->source;
+                status->MPI_TAG = state->tag;
+                return MPI_SUCCESS;
+            }
+
+            static int freeRequest(void* extraState)
+            {
+                delete static_cast<RequestState*>(extraState);
+                return MPI_SUCCESS;
+            }
+
+            static int cancelRequest(void*, int)
+            {
+                return MPI_SUCCESS;
+            }
+
+            void flushSendQueues()
+            {
+                for(auto& queue : sendQueues)
+                {
+                    std::vector<QueuedSend>& messages = queue.second;
+                    if(messages.empty())
+                        continue;
+
+                    size_t numBytes = sizeof(uint64_t) + messages.size() * sizeof(EntryHeader);
+                    for(auto const& message : messages)
+                        if(!message.isDirect)
+                            numBytes += message.numBytes;
+
+                    inFlightSends.emplace_back();
+                    InFlightSend& send = inFlightSends.back();
+                    send.buffer.resize(numBytes);
+
+                    char* ptr = send.buffer.data();
+                    uint64_t const numEntries = messages.size();
+                    std::memcpy(ptr, &numEntries, sizeof(uint64_t));
+                    ptr += sizeof(uint64_t);
+                    for(auto const& message : messages)
+                    {
+                        EntryHeader const header{message.numBytes, message.tag, message.isDirect ? 1 : 0};
+                        std::memcpy(ptr, &header, sizeof(EntryHeader));
+                        ptr += sizeof(EntryHeader);
+                        if(!message.isDirect)
+                        {
+                            std::memcpy(ptr, message.data, message.numBytes);
+                            ptr += message.numBytes;
+                        }
+                    }
+
+                    MPI_CHECK(MPI_Isend(
+                        send.buffer.data(),
+                        static_cast<int>(numBytes),
+                        MPI_CHAR,
+                        queue.first,
+                        aggregationTag,
+                        aggregationComm,
+                        &send.transfer));
+
+                    // the data of aggregated messages is copied and can be reused by the sender
+                    for(auto& message : messages)
+                        if(!message.isDirect)
+                            MPI_CHECK(MPI_Grequest_complete(message.request));
+                    messages.clear();
+                }
+            }
+
+            void receiveAggregatedMessages()
+            {
+                while(true)
+                {
+                    int flag = 0;
+                    MPI_Message mpiMessage;
+                    MPI_Status status;
+                    MPI_CHECK(
+                        MPI_Improbe(MPI_ANY_SOURCE, aggregationTag, aggregationComm, &flag, &mpiMessage, &status));
+                    if(!flag)
+                        return;
+
+                    int numBytes = 0;
+                    MPI_CHECK(MPI_Get_count(&status, MPI_CHAR, &numBytes));
+                    std::vector<char> buffer(numBytes);
+                    MPI_CHECK(MPI_Mrecv(buffer.data(), numBytes, MPI_CHAR, &mpiMessage, MPI_STATUS_IGNORE));
+
+                    int const source = status.MPI_SOURCE;
+                    const char* ptr = buffer.data();
+                    uint64_t numEntries = 0u;
+                    std::memcpy(&numEntries, ptr, sizeof(uint64_t));
+                    ptr += sizeof(uint64_t);
+                    for(uint64_t i = 0u; i < numEntries; ++i)
+                    {
+                        EntryHeader header;
+                        std::memcpy(&header, ptr, sizeof(EntryHeader));
+                        ptr += sizeof(EntryHeader);
+                        bool const isDirect = header.isDirect != 0;
+                        size_t const payloadBytes = isDirect ? 0u : header.numBytes;
+
+                        auto const key = std::make_pair(source, static_cast<int>(header.tag));
+                        auto posted = postedReceives.find(key);
+                        if(posted != postedReceives.end() && !posted->second.empty())
+                        {
+                            deliver(posted->second.front(), source, header.tag, isDirect, header.numBytes, ptr);
+                            posted->second.pop_front();
+                        }
+                        else
+                            unexpectedMessages[key].push_back(UnexpectedMessage{
+                                isDirect,
+                                header.numBytes,
+                                std::vector<char>(ptr, ptr + payloadBytes)});
+                        ptr += payloadBytes;
+                    }
+                }
+            }
+
+            /** hand a message out to a registered receive
+             *
+             * Messages which are not aggregated are received directly into the destination buffer.
+             */
+            void deliver(
+                PostedReceive const& receive,
+                int source,
+                int tag,
+                bool isDirect,
+                size_t numBytes,
+                const char* payload)
+            {
+                if(numBytes > receive.maxBytes)
+                    throw std::runtime_error("ExchangeAggregator: received message is larger than the receive buffer");
+
+                receive.state->numBytes = numBytes;
+                if(isDirect)
+                {
+                    MPI_Request transfer;
+                    MPI_CHECK(MPI_Irecv(
+                        receive.data,
+                        static_cast<int>(numBytes),
+                        MPI_CHAR,
+                        source,
+                        tag,
+                        aggregationComm,
+                        &transfer));
+                    directTransfers.push_back(DirectTransfer{transfer, receive.request});
+                }
+                else
+                {
+                    std::memcpy(receive.data, payload, numBytes);
+                    MPI_CHECK(MPI_Grequest_complete(receive.request));
+                }
+            }
+
+            void testRequests()
+            {
+                for(auto it = directTransfers.begin(); it != directTransfers.end();)
+                {
+                    int flag = 0;
+                    MPI_CHECK(MPI_Test(&it->transfer, &flag, MPI_STATUS_IGNORE));
+                    if(flag)
+                    {
+                        MPI_CHECK(MPI_Grequest_complete(it->request));
+                        it = directTransfers.erase(it);
+                    }
+                    else
+                        ++it;
+                }
+
+                for(auto it = inFlightSends.begin(); it != inFlightSends.end();)
+                {
+                    int flag = 0;
+                    MPI_CHECK(MPI_Test(&it->transfer, &flag, MPI_STATUS_IGNORE));
+                    if(flag)
+                        it = inFlightSends.erase(it);
+                    else
+                        ++it;
+                }
+            }
+
+            MPI_Comm aggregationComm = MPI_COMM_NULL;
+            bool isPackingEnabled = true;
+            //! messages waiting for the next flush, per destination rank
+            std::map<int, std::vector<QueuedSend>> sendQueues;
+            //! aggregated messages which are not finished, the buffer must stay alive until then
+            std::list<InFlightSend> inFlightSends;
+            std::list<DirectTransfer> directTransfers;
+            //! receives without a matching message, per (source rank, tag) in posting order
+            std::map<std::pair<int, int>, std::deque<PostedReceive>> postedReceives;
+            //! messages which arrived before the receive was registered, per (source rank, tag) in arrival order
+            std::map<std::pair<int, int>, std::deque<UnexpectedMessage>> unexpectedMessages;
+        };
+
+    } // namespace communication
+} // namespace pmacc
@@ -81,6 +81,24 @@ namespace pmacc
                     const container::HostBuffer<Type, conDim>& src,
                     ExprOrFunctor) const;
 
+                /* start the algorithm without waiting for its completion
+                 *
+                 * Same as operator() but based on a non-blocking reduce.
+                 * dest and src must not be accessed until the returned request is completed, e.g. with MPI_Wait().
+                 * All participating nodes must start their non-blocking reduce operations in the same order.
+                 *
+                 * @param dest destination container
+                 * @param src source container
+                 * @param ExprOrFunctor functor with two arguments which returns the result of the reduce operation.
+                 *
+                 * @return request of the reduce operation, MPI_REQUEST_NULL if this node does not participate
+                 */
+                template<typename Type, int conDim, typename ExprOrFunctor>
+                MPI_Request startReduce(
+                    container::HostBuffer<Type, conDim>& dest,
+                    const container::HostBuffer<Type, conDim>& src,
+                    ExprOrFunctor) const;
+
                 // Returns whether this node is within the zone.
                 inline bool participate() const
                 {
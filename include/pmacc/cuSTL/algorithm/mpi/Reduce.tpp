@@ -183,6 +183,35 @@ namespace pmacc
                 MPI_CHECK(MPI_Op_free(&user_op));
             }
 
+            template<int dim>
+            template<typename Type, int conDim, typename Functor>
+            MPI_Request Reduce<dim>::startReduce(
+                container::HostBuffer<Type, conDim>& dest,
+                const container::HostBuffer<Type, conDim>& src,
+                Functor) const
+            {
+                MPI_Request request = MPI_REQUEST_NULL;
+                if(!this->m_participate)
+                    return request;
+
+                MPI_Op user_op;
+                MPI_CHECK(MPI_Op_create(&detail::MPI_User_Op<Functor, Type>::callback, 1, &user_op));
+
+                MPI_CHECK(MPI_Ireduce(
+                    &(*src.origin()),
+                    &(*dest.origin()),
+                    sizeof(Type) * dest.size().productOfComponents(),
+                    MPI_CHAR,
+                    user_op,
+                    0,
+                    this->comm,
+                    &request));
+
+                // the operation is only marked for deallocation, the pending reduce completes normally
+                MPI_CHECK(MPI_Op_free(&user_op));
+                return request;
+            }
+
         } // namespace mpi
     } // namespace algorithm
 } // namespace pmacc
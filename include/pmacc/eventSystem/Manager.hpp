@@ -25,8 +25,12 @@
 #include "pmacc/Environment.def"
 #include "pmacc/eventSystem/tasks/ITask.hpp"
 
+#include <cstdint>
 #include <map>
 #include <set>
+#include <vector>
+
+#include <mpi.h>
 
 namespace pmacc
 {
@@ -35,6 +39,15 @@ namespace pmacc
 
     /**
      * Manages the event system by executing and waiting for tasks.
+     *
+     * Active tasks are scheduled by the way they can finish:
+     *   - MPI tasks with a single pending request are tested all at once with MPI_Testsome
+     *   - device tasks are tested via their cupla event
+     *   - all other tasks only progress if other tasks finish, they are executed once after they are added and
+     *     then again only if any task finished since their last execution or if no MPI, device or ready task is
+     *     left
+     *
+     * A task which does not wait for another task must therefore not return from execute() without finishing.
      */
     class Manager : public IEvent
     {
@@ -92,6 +105,33 @@ namespace pmacc
 
         inline ITask* getActiveITaskIfNotFinished(id_t taskId) const;
 
+        /** test the pending MPI requests and finish the tasks owning them
+         *
+         * @param taskToWait id of a task, 0 if no task is searched
+         * @return true if taskToWait is finished
+         */
+        inline bool executeMPITasks(id_t taskToWait);
+
+        /** test the cupla events of device tasks and finish the finished tasks
+         *
+         * @param taskToWait id of a task, 0 if no task is searched
+         * @return true if taskToWait is finished
+         */
+        inline bool executeStreamTasks(id_t taskToWait);
+
+        /** execute all ready tasks, tasks which are not finished wait until the next task is finished
+         *
+         * @param taskToWait id of a task, 0 if no task is searched
+         * @return true if taskToWait is finished
+         */
+        inline bool executeReadyTasks(id_t taskToWait);
+
+        /** remove a finished task from the manager and delete it
+         *
+         * Deleting the task notifies its observers, which can add and finish other tasks.
+         */
+        inline void finishTask(id_t taskId, ITask* task);
+
         Manager();
 
         Manager(const Manager& cc);
@@ -106,6 +146,23 @@ namespace pmacc
 
         TaskMap tasks;
         TaskMap passiveTasks;
+
+        //! tasks executed with the next call of execute()
+        std::vector<id_t> readyTasks;
+        //! tasks executed again as soon as any task is finished
+        std::vector<id_t> waitingTasks;
+        //! device tasks, finished as soon as their cupla event is finished
+        TaskSet streamTasks;
+        //! pending MPI requests and the ids of the tasks owning them (same order)
+        std::vector<MPI_Request> mpiRequests;
+        std::vector<id_t> mpiRequestTaskIds;
+        //! scratch memory for MPI_Testsome
+        std::vector<int> mpiFinishedIndices;
+        std::vector<MPI_Status> mpiFinishedStatuses;
+
+        //! number of finished tasks, used to wake up waiting tasks
+        uint64_t numFinishedTasks = 0u;
+        uint64_t numFinishedTasksAtWakeUp = 0u;
     };
 
 } // namespace pmacc
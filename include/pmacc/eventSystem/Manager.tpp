@@ -22,14 +22,21 @@
 #pragma once
 
 #include "pmacc/assert.hpp"
+#include "pmacc/communication/ExchangeAggregator.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
 #include "pmacc/eventSystem/Manager.hpp"
 #include "pmacc/eventSystem/streams/StreamController.hpp"
+#include "pmacc/eventSystem/tasks/MPITask.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 
+#include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <set>
+#include <utility>
+#include <vector>
 
 //#define DEBUG_EVENTS
 
@@ -45,67 +52,157 @@ namespace pmacc
     inline bool Manager::execute(id_t taskToWait)
     {
 #ifdef DEBUG_EVENTS
-        static int old_max = 0;
-        static int deep = -1;
         static int counter = 0;
-        ++counter;
-
-        deep++;
-        if(deep > old_max)
+        if(++counter == 500000)
         {
-            old_max = deep;
+            for(auto const& task : tasks)
+                std::cout << task.second->toString() << " " << passiveTasks.size() << std::endl;
+            counter = 0;
         }
+        uint64_t const numFinishedBefore = numFinishedTasks;
 #endif
 
-        static auto iter = tasks.begin();
+#if(PMACC_EXCHANGE_AGGREGATION == 1)
+        // send the exchange messages queued since the last call and serve incoming aggregated messages
+        communication::ExchangeAggregator::get().progress();
+#endif
 
-        if(iter == tasks.end())
-            iter = tasks.begin();
+        bool isTaskToWaitFinished = executeMPITasks(taskToWait);
+        isTaskToWaitFinished = executeStreamTasks(taskToWait) || isTaskToWaitFinished;
 
-        // this is the slow but very save variant to delete tasks in a map
-        while(iter != tasks.end())
+        /* All waiting tasks get a chance to progress as soon as any task is finished.
+         * If no other task is left which could finish, they are polled to never stall the waiting caller.
+         */
+        bool const isAnyOtherTaskPending = !readyTasks.empty() || !mpiRequests.empty() || !streamTasks.empty();
+        if(numFinishedTasks != numFinishedTasksAtWakeUp || !isAnyOtherTaskPending)
         {
-            id_t id = iter->first;
-            ITask* taskPtr = iter->second;
-            PMACC_ASSERT(taskPtr != nullptr);
-            ++iter;
+            numFinishedTasksAtWakeUp = numFinishedTasks;
+            readyTasks.insert(readyTasks.end(), waitingTasks.begin(), waitingTasks.end());
+            waitingTasks.clear();
+        }
+        isTaskToWaitFinished = executeReadyTasks(taskToWait) || isTaskToWaitFinished;
+
 #ifdef DEBUG_EVENTS
-            if(counter == 500000)
-                std::cout << taskPtr->toString() << " " << passiveTasks.size() << std::endl;
+        if(numFinishedTasks != numFinishedBefore)
+            counter = 0;
 #endif
+
+        return isTaskToWaitFinished;
+    }
+
+    inline bool Manager::executeMPITasks(id_t taskToWait)
+    {
+        if(mpiRequests.empty())
+            return false;
+
+        int const numRequests = static_cast<int>(mpiRequests.size());
+        mpiFinishedIndices.resize(numRequests);
+        mpiFinishedStatuses.resize(numRequests);
+        int numFinished = 0;
+        MPI_CHECK(MPI_Testsome(
+            numRequests,
+            mpiRequests.data(),
+            &numFinished,
+            mpiFinishedIndices.data(),
+            mpiFinishedStatuses.data()));
+
+        if(numFinished == MPI_UNDEFINED || numFinished == 0)
+            return false;
+
+        /* Remove the finished requests before any task is finished because finishing a task can add new MPI tasks
+         * and execute the manager recursively.
+         */
+        std::vector<std::pair<id_t, MPI_Status>> finished;
+        finished.reserve(numFinished);
+        for(int i = 0; i < numFinished; ++i)
+            finished.emplace_back(mpiRequestTaskIds[mpiFinishedIndices[i]], mpiFinishedStatuses[i]);
+
+        // remove from back to front, the element swapped in from the back is never a finished one
+        std::sort(mpiFinishedIndices.begin(), mpiFinishedIndices.begin() + numFinished, std::greater<int>());
+        for(int i = 0; i < numFinished; ++i)
+        {
+            int const idx = mpiFinishedIndices[i];
+            mpiRequests[idx] = mpiRequests.back();
+            mpiRequests.pop_back();
+            mpiRequestTaskIds[idx] = mpiRequestTaskIds.back();
+            mpiRequestTaskIds.pop_back();
+        }
+
+        bool isTaskToWaitFinished = false;
+        for(auto const& request : finished)
+        {
+            id_t const id = request.first;
+            ITask* taskPtr = getActiveITaskIfNotFinished(id);
+            PMACC_ASSERT(taskPtr != nullptr);
+            static_cast<MPITask*>(taskPtr)->setMPIRequestFinished(request.second);
+            finishTask(id, taskPtr);
+            if(id == taskToWait)
+                isTaskToWaitFinished = true;
+        }
+        return isTaskToWaitFinished;
+    }
+
+    inline bool Manager::executeStreamTasks(id_t taskToWait)
+    {
+        // testing a device task has no side effects, therefore the set is not modified while it is traversed
+        std::vector<std::pair<id_t, ITask*>> finished;
+        for(id_t const id : streamTasks)
+        {
+            ITask* taskPtr = getActiveITaskIfNotFinished(id);
+            PMACC_ASSERT(taskPtr != nullptr);
             if(taskPtr->execute())
-            {
-                /*test if task is deleted by other stackdeep*/
-                if(getActiveITaskIfNotFinished(id) == taskPtr)
-                {
-                    tasks.erase(id);
-                    delete taskPtr;
-                }
-#ifdef DEBUG_EVENTS
-                counter = 0;
-#endif
+                finished.emplace_back(id, taskPtr);
+        }
 
-                if(taskToWait == id)
-                {
-                    iter = tasks.end();
-#ifdef DEBUG_EVENTS
-                    --deep;
-#endif
-                    return true; // jump out because searched task is finished
-                }
-            }
+        bool isTaskToWaitFinished = false;
+        for(auto const& task : finished)
+            streamTasks.erase(task.first);
+        for(auto const& task : finished)
+        {
+            finishTask(task.first, task.second);
+            if(task.first == taskToWait)
+                isTaskToWaitFinished = true;
         }
+        return isTaskToWaitFinished;
+    }
 
-#ifdef DEBUG_EVENTS
-        --deep;
-#endif
+    inline bool Manager::executeReadyTasks(id_t taskToWait)
+    {
+        /* Executing a task can add tasks and execute the manager recursively.
+         * Tasks added meanwhile are executed with the next call.
+         */
+        std::vector<id_t> executeNow;
+        executeNow.swap(readyTasks);
+
+        bool isTaskToWaitFinished = false;
+        for(id_t const id : executeNow)
+        {
+            ITask* taskPtr = getActiveITaskIfNotFinished(id);
+            PMACC_ASSERT(taskPtr != nullptr);
+            if(taskPtr->execute())
+            {
+                finishTask(id, taskPtr);
+                if(id == taskToWait)
+                    isTaskToWaitFinished = true;
+            }
+            else
+                waitingTasks.push_back(id);
+        }
+        return isTaskToWaitFinished;
+    }
 
-        return false;
+    inline void Manager::finishTask(id_t taskId, ITask* task)
+    {
+        tasks.erase(taskId);
+        ++numFinishedTasks;
+        delete task;
+        profiling::Profiler::get().stopTask(taskId);
     }
 
     inline void Manager::event(id_t eventId, EventType, IEventData*)
     {
         passiveTasks.erase(eventId);
+        ++numFinishedTasks;
     }
 
     inline ITask* Manager::getITaskIfNotFinished(id_t taskId) const
@@ -184,7 +281,28 @@ namespace pmacc
     inline void Manager::addTask(ITask* task)
     {
         PMACC_ASSERT(task != nullptr);
-        tasks[task->getId()] = task;
+        id_t const id = task->getId();
+        tasks[id] = task;
+
+        if(task->getTaskType() == ITask::TASK_DEVICE)
+        {
+            streamTasks.insert(id);
+            return;
+        }
+
+        // only passive tasks can be of type TASK_MPI without being a MPITask
+        if(task->getTaskType() == ITask::TASK_MPI)
+        {
+            MPI_Request* request = static_cast<MPITask*>(task)->getMPIRequest();
+            if(request != nullptr)
+            {
+                mpiRequests.push_back(*request);
+                mpiRequestTaskIds.push_back(id);
+                return;
+            }
+        }
+
+        readyTasks.push_back(id);
     }
 
     inline void Manager::addPassiveTask(ITask* task)
@@ -195,7 +313,11 @@ namespace pmacc
         passiveTasks[task->getId()] = task;
     }
 
-    inline Manager::Manager() = default;
+    inline Manager::Manager()
+    {
+        // the profiler is used until the manager is destroyed, therefore it must be constructed before
+        profiling::Profiler::get();
+    }
 
     inline Manager::Manager(const Manager&)
     {
@@ -25,6 +25,7 @@
 #include "pmacc/Environment.hpp"
 #include "pmacc/dimensions/DataSpace.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 #include "pmacc/traits/GetNComponents.hpp"
 #include "pmacc/types.hpp"
 
@@ -160,8 +161,17 @@ namespace pmacc
 
                 DataSpace<traits::GetNComponents<T_VectorBlock>::value> blockExtent(m_blockExtent);
 
+                profiling::Profiler& profiler = profiling::Profiler::get();
+                bool const isProfiled = profiler.isEnabled();
+                cuplaEvent_t profilingEvent{};
+                if(isProfiled)
+                    profilingEvent = profiler.startKernel(taskKernel->getCudaStream());
+
                 CUPLA_KERNEL(typename T_Kernel::KernelType)
                 (gridExtent.toDim3(), blockExtent.toDim3(), m_sharedMemByte, taskKernel->getCudaStream())(args...);
+
+                if(isProfiled)
+                    profiler.stopKernel(kernelName, profilingEvent, taskKernel->getCudaStream());
                 CUDA_CHECK_KERNEL_MSG(
                     cuplaGetLastError(),
                     std::string("Last error after kernel launch ") + kernelInfo);
@@ -38,6 +38,7 @@
 #include "pmacc/memory/buffers/DeviceBuffer.hpp"
 #include "pmacc/memory/buffers/Exchange.hpp"
 #include "pmacc/memory/buffers/HostBuffer.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 
 namespace pmacc
 {
@@ -226,6 +227,10 @@ namespace pmacc
         }
         EventTask event(task.getId());
 
+        profiling::Profiler& profiler = profiling::Profiler::get();
+        if(profiler.isEnabled())
+            profiler.startTask(task.getId(), task.toString());
+
         task.init();
         Environment<>::get().Manager().addTask(&task);
         Environment<>::get().TransactionManager().setTransactionEvent(event);
@@ -47,6 +47,29 @@ namespace pmacc
          */
         ~MPITask() override = default;
 
+        /**
+         * Returns the pending MPI request of the task.
+         * The Manager tests the requests of all MPI tasks with one MPI_Testsome call instead of executing each
+         * task. The value must be available after init() and must not change until setMPIRequestFinished() is
+         * called.
+         *
+         * @return pointer to the request, nullptr if the task does not wait for a single MPI request
+         */
+        virtual MPI_Request* getMPIRequest()
+        {
+            return nullptr;
+        }
+
+        /**
+         * Called by the Manager when the request returned by getMPIRequest() is finished.
+         * The request is already freed by MPI and must not be tested again.
+         *
+         * @param status status of the finished request
+         */
+        virtual void setMPIRequestFinished(MPI_Status const&)
+        {
+        }
+
     protected:
         /**
          * Returns if the task is finished.
@@ -77,6 +77,19 @@ namespace pmacc
             return false;
         }
 
+        MPI_Request* getMPIRequest() override
+        {
+            return this->request;
+        }
+
+        void setMPIRequestFinished(MPI_Status const& requestStatus) override
+        {
+            this->status = requestStatus;
+            delete this->request;
+            this->request = nullptr;
+            setFinished();
+        }
+
         ~TaskReceiveMPI() override
         {
             //! \todo this make problems because we send bytes and not combined types
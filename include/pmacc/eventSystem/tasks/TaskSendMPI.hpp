@@ -26,6 +26,7 @@
 #include "pmacc/communication/ICommunicator.hpp"
 #include "pmacc/eventSystem/tasks/MPITask.hpp"
 #include "pmacc/memory/buffers/Buffer.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 
 #include <mpi.h>
 
@@ -46,6 +47,10 @@ namespace pmacc
         {
             Buffer<TYPE, DIM>* src = exchange->getCommunicationBuffer();
 
+            profiling::Profiler& profiler = profiling::Profiler::get();
+            if(profiler.isEnabled())
+                profiler.addBytes("TaskSendMPI", src->getCurrentSize() * sizeof(TYPE));
+
             this->request = Environment<DIM>::get().EnvironmentController().getCommunicator().startSend(
                 exchange->getExchangeType(),
                 reinterpret_cast<char*>(src->getPointer()),
@@ -74,6 +79,19 @@ namespace pmacc
             return false;
         }
 
+        MPI_Request* getMPIRequest() override
+        {
+            return this->request;
+        }
+
+        void setMPIRequestFinished(MPI_Status const& requestStatus) override
+        {
+            this->status = requestStatus;
+            delete this->request;
+            this->request = nullptr;
+            this->setFinished();
+        }
+
         ~TaskSendMPI() override
         {
             notify(this->myId, SENDFINISHED, nullptr);
@@ -21,6 +21,7 @@
 
 #pragma once
 
+#include "pmacc/attribute/Fallthrough.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
 #include "pmacc/eventSystem/events/EventDataReceive.hpp"
 #include "pmacc/eventSystem/tasks/ITask.hpp"
@@ -66,11 +67,13 @@ namespace pmacc
             case Init:
                 break;
             case WaitForReceived:
-                if(nullptr == Environment<>::get().Manager().getITaskIfNotFinished(m_tmpEvent.getTaskId()))
-                {
-                    m_state = Insert;
-                }
-                break;
+                if(nullptr != Environment<>::get().Manager().getITaskIfNotFinished(m_tmpEvent.getTaskId()))
+                    break;
+                /* Insert without returning, the manager executes a not finished task again only after another
+                 * task is finished.
+                 */
+                m_state = Insert;
+                PMACC_FALLTHROUGH;
             case Insert:
                 m_state = Wait;
                 __startTransaction();
@@ -19,6 +19,8 @@
  * If not, see <http://www.gnu.org/licenses/>.
  */
 
+#pragma once
+
 // pmacc
 #include "pmacc/Environment.hpp"
 #include "pmacc/dataManagement/DataConnector.hpp"
@@ -48,7 +48,8 @@ namespace pmacc
             using Key = typename T_Pair::first;
             using ValueType = typename T_Pair::second;
 
-            PMACC_ALIGN(value, ValueType);
+            // alignas(ValueType) keeps the alignment of over-aligned value types
+            alignas(ValueType) PMACC_ALIGN(value, ValueType);
 
             HDINLINE AlignedData() = default;
 
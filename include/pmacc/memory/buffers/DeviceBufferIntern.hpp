@@ -325,10 +325,8 @@ namespace pmacc
     template<class TYPE, unsigned DIM>
     HINLINE std::unique_ptr<DeviceBufferIntern<TYPE, DIM>> makeDeepCopy(DeviceBuffer<TYPE, DIM>& source)
     {
-        auto result = std::make_unique<DeviceBufferIntern<TYPE, DIM>>(
-            source,
-            source.getDataSpace(),
-            DataSpace<DIM>::create(0));
+        // allocate own memory, the constructor taking a source buffer would only create a view to it
+        auto result = std::make_unique<DeviceBufferIntern<TYPE, DIM>>(source.getDataSpace());
         result->copyFrom(source);
         // Wait for copy to finish, so that the resulting object is safe to use after return
         __getTransactionEvent().waitForFinished();
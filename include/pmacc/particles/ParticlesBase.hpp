@@ -131,6 +131,26 @@ namespace pmacc
                 onlyProcessMustShiftSupercells);
         }
 
+        /** Shift the particles leaving the local domain from the border into the guard
+         *
+         * Allows to start the particle exchange before all other particles are shifted.
+         * Particles moving to another supercell of the local domain keep their mark and the
+         * border supercells keep mustShift set, they are shifted by the next call of
+         * shiftParticles() which processes the border with onlyProcessMustShiftSupercells set.
+         * Supercells outside of the border are not accessed and can be modified concurrently.
+         */
+        void shiftParticlesToGuard()
+        {
+            auto const onlyProcessMustShiftSupercells = true;
+            auto const onlyShiftToGuard = true;
+            // there is no stride mapping for the border only, supercells of the core are skipped by the kernel
+            using AreaFactory = AreaMapperFactory<CORE + BORDER>;
+            this->template shiftParticlesImpl(
+                StrideMapperFactory<AreaFactory, 3>{AreaFactory{}},
+                onlyProcessMustShiftSupercells,
+                onlyShiftToGuard);
+        }
+
     public:
         /** Fill gaps in an area defined by a mapper factory
          *
@@ -164,6 +184,39 @@ namespace pmacc
             this->fillGaps(AreaMapperFactory<BORDER>{});
         }
 
+        /** Sort particles within each supercell by their cell index
+         *
+         * Particles are copied into newly allocated frames, this removes all gaps and restores the memory
+         * locality of the frames of a supercell.
+         * Supercells with more than maxFramesPerSuperCell frames are not sorted.
+         * The old frames of a supercell are released after its particles are copied, to bound the additional
+         * heap memory the area is processed in strided batches, only one supercell out of 3^dim is sorted at
+         * the same time.
+         * Supercells for which the frames can not be allocated keep their particles unsorted.
+         *
+         * @tparam T_MapperFactory factory type to construct a mapper that defines the area to process
+         *
+         * @param mapperFactory factory instance
+         */
+        template<typename T_MapperFactory>
+        void sortParticles(T_MapperFactory const& mapperFactory)
+        {
+            auto mapper = StrideMapperFactory<T_MapperFactory, 3>{mapperFactory}(this->cellDescription);
+
+            constexpr uint32_t numWorkers
+                = traits::GetNumWorkers<math::CT::volume<typename FrameType::SuperCellSize>::type::value>::value;
+            // the frame pointers of a supercell are held in shared memory
+            constexpr uint32_t maxFramesPerSuperCell = 256u;
+
+            __startTransaction(__getTransactionEvent());
+            do
+            {
+                PMACC_KERNEL(KernelSortParticles<numWorkers, maxFramesPerSuperCell>{})
+                (mapper.getGridDim(), numWorkers)(particlesBuffer->getDeviceParticleBox(), mapper);
+            } while(mapper.next());
+            __setTransactionEvent(__endTransaction());
+        }
+
         /* Delete all particles in GUARD for one direction.
          */
         void deleteGuardParticles(uint32_t exchangeType);
@@ -221,9 +274,13 @@ namespace pmacc
          *                            the area is defined by the constructed mapper object
          * @param onlyProcessMustShiftSupercells whether to process only supercells with mustShift set to true
          * (optimization to be used with particle pusher) or process all supercells
+         * @param onlyShiftToGuard shift only particles moving into a guard supercell, @see shiftParticlesToGuard()
          */
         template<typename T_strideMapperFactory>
-        void shiftParticlesImpl(T_strideMapperFactory const& strideMapperFactory, bool onlyProcessMustShiftSupercells)
+        void shiftParticlesImpl(
+            T_strideMapperFactory const& strideMapperFactory,
+            bool onlyProcessMustShiftSupercells,
+            bool onlyShiftToGuard = false)
         {
             auto mapper = strideMapperFactory(this->cellDescription);
             PMACC_CASSERT_MSG(
@@ -239,7 +296,7 @@ namespace pmacc
             {
                 PMACC_KERNEL(KernelShiftParticles<numWorkers>{})
                 (mapper.getGridDim(),
-                 numWorkers)(pBox, mapper, numSupercellsWithGuards, onlyProcessMustShiftSupercells);
+                 numWorkers)(pBox, mapper, numSupercellsWithGuards, onlyProcessMustShiftSupercells, onlyShiftToGuard);
             } while(mapper.next());
 
             __setTransactionEvent(__endTransaction());
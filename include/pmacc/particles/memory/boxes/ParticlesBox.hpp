@@ -93,22 +93,9 @@ namespace pmacc
             const int maxTries = 13; // magic number is not performance critical
             for(int numTries = 0; numTries < maxTries; ++numTries)
             {
-#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
-                tmp = (FrameType*) m_deviceHeapHandle.malloc(acc, sizeof(FrameType));
-#else
-                tmp = new FrameType;
-#endif
+                tmp = allocateFrame(acc);
                 if(tmp != nullptr)
-                {
-                    /* disable all particles since we can not assume that newly allocated memory contains zeros */
-                    for(int i = 0; i < (int) math::CT::volume<typename FrameType::SuperCellSize>::type::value; ++i)
-                        (*tmp)[i][multiMask_] = 0;
-#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
-                    /* takes care that changed values are visible to all threads inside this block*/
-                    __threadfence_block();
-#endif
                     break;
-                }
                 else
                 {
 #ifndef BOOST_COMP_HIP
@@ -124,6 +111,19 @@ namespace pmacc
             return FramePtr(tmp);
         }
 
+        /**
+         * Returns an empty frame from data heap with a single try and without reporting a failure.
+         *
+         * For algorithms which handle an exhausted heap themselves, e.g. by keeping the existing frames.
+         *
+         * @return an empty frame, invalid if no memory is left
+         */
+        template<typename T_Acc>
+        DINLINE FramePtr tryGetEmptyFrame(const T_Acc& acc)
+        {
+            return FramePtr(allocateFrame(acc));
+        }
+
         /**
          * Removes frame from heap data heap.
          *
@@ -308,6 +308,32 @@ namespace pmacc
         {
             return BaseType::operator()(idx);
         }
+
+    private:
+        /** allocate a frame with all particles disabled
+         *
+         * @return pointer to the frame, nullptr if the allocation failed
+         */
+        template<typename T_Acc>
+        DINLINE FrameType* allocateFrame(const T_Acc& acc)
+        {
+#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
+            FrameType* tmp = (FrameType*) m_deviceHeapHandle.malloc(acc, sizeof(FrameType));
+#else
+            FrameType* tmp = new FrameType;
+#endif
+            if(tmp != nullptr)
+            {
+                /* disable all particles since we can not assume that newly allocated memory contains zeros */
+                for(int i = 0; i < (int) math::CT::volume<typename FrameType::SuperCellSize>::type::value; ++i)
+                    (*tmp)[i][multiMask_] = 0;
+#if(BOOST_LANG_CUDA || BOOST_COMP_HIP)
+                /* takes care that changed values are visible to all threads inside this block*/
+                __threadfence_block();
+#endif
+            }
+            return tmp;
+        }
     };
 
 } // namespace pmacc
@@ -37,6 +37,7 @@
 #include "pmacc/particles/memory/dataTypes/StaticArray.hpp"
 #include "pmacc/particles/memory/dataTypes/SuperCell.hpp"
 #include "pmacc/particles/memory/frames/Frame.hpp"
+#include "pmacc/traits/GetSimdAlignment.hpp"
 #include "pmacc/traits/GetUniqueTypeId.hpp"
 
 #include <boost/mpl/back_inserter.hpp>
@@ -60,15 +61,22 @@ namespace pmacc
     {
     public:
         /** create static array
+         *
+         * @tparam T_size number of elements
+         * @tparam T_alignment minimum alignment in bytes of each array
          */
-        template<uint32_t T_size>
+        template<uint32_t T_size, uint32_t T_alignment = 1u>
         struct OperatorCreatePairStaticArray
         {
             template<typename X>
             struct apply
             {
-                using type = bmpl::
-                    pair<X, StaticArray<typename traits::Resolve<X>::type::type, bmpl::integral_c<uint32_t, T_size>>>;
+                using type = bmpl::pair<
+                    X,
+                    StaticArray<
+                        typename traits::Resolve<X>::type::type,
+                        bmpl::integral_c<uint32_t, T_size>,
+                        T_alignment>>;
             };
         };
 
@@ -102,9 +110,13 @@ namespace pmacc
         /** frame definition
          *
          * a group of particles is stored as frame
+         * Each attribute array is aligned for SIMD access if PMACC_SIMD_FRAME_LAYOUT is enabled, see
+         * traits::GetSimdAlignment.
          */
         using FrameType = Frame<
-            OperatorCreatePairStaticArray<pmacc::math::CT::volume<SuperCellSize>::type::value>,
+            OperatorCreatePairStaticArray<
+                pmacc::math::CT::volume<SuperCellSize>::type::value,
+                traits::GetSimdAlignment<>::value>,
             FrameDescription>;
 
         using FrameDescriptionBorder =
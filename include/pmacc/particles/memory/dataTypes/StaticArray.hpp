@@ -28,7 +28,14 @@ namespace pmacc
 {
     namespace pmath = pmacc::math;
 
-    template<typename T_Type, typename T_size>
+    /** array with a compile time size
+     *
+     * @tparam T_Type value type
+     * @tparam T_size integral type with the number of elements
+     * @tparam T_alignment minimum alignment in bytes of the storage,
+     *                     the natural alignment of T_Type is used if it is stricter
+     */
+    template<typename T_Type, typename T_size, uint32_t T_alignment = 1u>
     class StaticArray
     {
     public:
@@ -36,7 +43,7 @@ namespace pmacc
         using Type = T_Type;
 
     private:
-        Type data[size];
+        alignas(Type) alignas(T_alignment) Type data[size];
 
     public:
         HDINLINE
@@ -40,6 +40,10 @@
 #include <boost/mpl/map.hpp>
 #include <boost/utility/result_of.hpp>
 
+#include <alpaka/core/AlignedAlloc.hpp>
+
+#include <cstddef>
+
 namespace pmacc
 {
     namespace pmath = pmacc::math;
@@ -120,6 +124,25 @@ namespace pmacc
         {
             return Name::str();
         }
+
+#if(!BOOST_LANG_CUDA && !BOOST_COMP_HIP)
+        /** allocate a frame on CPU accelerators
+         *
+         * Respects the alignment of over-aligned attribute arrays, this is not guaranteed by the
+         * default `new` before C++17.
+         *
+         * @return nullptr if the allocation fails
+         */
+        HINLINE static void* operator new(std::size_t size) noexcept
+        {
+            return alpaka::core::alignedAlloc(alignof(ThisType), size);
+        }
+
+        HINLINE static void operator delete(void* ptr) noexcept
+        {
+            alpaka::core::alignedFree(ptr);
+        }
+#endif
     };
 
     namespace traits
@@ -23,6 +23,7 @@
 #pragma once
 
 #include "pmacc/Environment.hpp"
+#include "pmacc/attribute/Fallthrough.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
 #include "pmacc/traits/NumberOfExchanges.hpp"
 
@@ -79,9 +80,13 @@ namespace pmacc
             case Init:
                 break;
             case WaitForReceived:
-                if(nullptr == Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
-                    state = CallFillGaps;
-                break;
+                if(nullptr != Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
+                    break;
+                /* fill the gaps without returning, the manager executes a not finished task again only after
+                 * another task is finished
+                 */
+                state = CallFillGaps;
+                PMACC_FALLTHROUGH;
             case CallFillGaps:
                 state = WaitForFillGaps;
                 __startTransaction();
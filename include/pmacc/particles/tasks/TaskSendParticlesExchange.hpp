@@ -23,6 +23,7 @@
 #pragma once
 
 #include "pmacc/assert.hpp"
+#include "pmacc/attribute/Fallthrough.hpp"
 #include "pmacc/eventSystem/EventSystem.hpp"
 #include "pmacc/type/Exchange.hpp"
 
@@ -84,19 +85,21 @@ namespace pmacc
             case InitSend:
                 break;
             case WaitForSend:
-                if(nullptr == Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
+                if(nullptr != Environment<>::get().Manager().getITaskIfNotFinished(tmpEvent.getTaskId()))
+                    break;
+                PMACC_ASSERT(lastSize <= maxSize);
+                // check for next bash round
+                if(lastSize == maxSize)
                 {
-                    PMACC_ASSERT(lastSize <= maxSize);
-                    // check for next bash round
-                    if(lastSize == maxSize)
-                    {
-                        ++retryCounter;
-                        init(); // call init and run a full send cycle
-                    }
-                    else
-                        state = WaitForSendEnd;
+                    ++retryCounter;
+                    init(); // call init and run a full send cycle
+                    break;
                 }
-                break;
+                /* check the send without returning, it can be finished already and the manager executes a not
+                 * finished task again only after another task is finished
+                 */
+                state = WaitForSendEnd;
+                PMACC_FALLTHROUGH;
             case WaitForSendEnd:
                 if(nullptr == Environment<>::get().Manager().getITaskIfNotFinished(lastSendEvent.getTaskId()))
                 {
@@ -27,9 +27,14 @@
 #include "pmacc/pluginSystem/TimeSlice.hpp"
 #include "pmacc/pluginSystem/containsStep.hpp"
 #include "pmacc/pluginSystem/toTimeSlice.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 
+#include <boost/core/demangle.hpp>
+
+#include <cstdint>
 #include <list>
 #include <string>
+#include <typeinfo>
 #include <vector>
 
 
@@ -150,12 +155,26 @@ namespace pmacc
                 if(containsStep((*iter).second, currentStep))
                 {
                     INotify* notifiedObj = iter->first;
+                    ++numNotifications;
+                    // tag kernels and tasks with the plugin name, the name is only built if profiling is enabled
+                    profiling::ScopedStage profilingStage(
+                        profiling::Profiler::get().isEnabled() ? getProfilingName(notifiedObj) : std::string());
                     notifiedObj->notify(currentStep);
                     notifiedObj->setLastNotify(currentStep);
                 }
             }
         }
 
+        /** Get the number of notifications since the start of the simulation
+         *
+         * Called by a notified object, the result identifies its notification.
+         * Objects notified directly one after the other get consecutive numbers.
+         */
+        uint64_t getNumNotifications() const
+        {
+            return numNotifications;
+        }
+
         /**
          * Notifies plugins that a restartable checkpoint should be dumped.
          *
@@ -226,7 +245,22 @@ namespace pmacc
 
         virtual ~PluginConnector() = default;
 
+        /** name of a notified object used as profiling stage
+         *
+         * Plugins are named by pluginGetName(), other objects by their type without template arguments.
+         */
+        static std::string getProfilingName(INotify* notifiedObj)
+        {
+            auto* plugin = dynamic_cast<IPlugin*>(notifiedObj);
+            if(plugin != nullptr)
+                return plugin->pluginGetName();
+            std::string const typeName = boost::core::demangle(typeid(*notifiedObj).name());
+            return typeName.substr(0, typeName.find('<'));
+        }
+
         std::list<IPlugin*> plugins;
         NotificationList notificationList;
+        //! number of notifications done by notifyPlugins()
+        uint64_t numNotifications = 0u;
     };
 } // namespace pmacc
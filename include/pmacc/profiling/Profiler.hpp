@@ -0,0 +1,258 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/profiling/Statistics.hpp"
+#include "pmacc/types.hpp"
+
+#include <boost/core/demangle.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+
+namespace pmacc
+{
+    namespace profiling
+    {
+        /** collect the execution time of kernels and tasks tagged with the simulation stage they belong to
+         *
+         * Kernels launched with PMACC_KERNEL are timed with alpaka events enqueued in the stream of the kernel.
+         * Tasks started by the task factories (e.g. field and particle exchanges) are timed on the host from
+         * their start until the event system deletes them, therefore the time includes waiting for the
+         * communication partner and overlaps with the time of kernels.
+         *
+         * Measurements are keyed by `<stage>/<name>` where the stage is the innermost active ScopedStage.
+         * The profiler is disabled by default, if enabled each kernel launch records two timing events which
+         * can serialize the execution on accelerators emulating events on the host.
+         */
+        class Profiler
+        {
+        public:
+            static Profiler& get()
+            {
+                static Profiler instance;
+                return instance;
+            }
+
+            void setEnabled(bool const enable)
+            {
+                enabled = enable;
+            }
+
+            bool isEnabled() const
+            {
+                return enabled;
+            }
+
+            //! enter a stage, stages can be nested, nothing is recorded if the profiler is disabled
+            void enterStage(std::string const& name)
+            {
+                if(!enabled)
+                    return;
+                stages.push_back(stages.empty() ? name : stages.back() + std::string(".") + name);
+            }
+
+            void leaveStage()
+            {
+                if(!stages.empty())
+                    stages.pop_back();
+            }
+
+            //! name of the innermost stage
+            std::string getStage() const
+            {
+                return stages.empty() ? std::string("unnamed") : stages.back();
+            }
+
+            /** record the start of a kernel
+             *
+             * @param stream stream the kernel is enqueued into
+             * @return event handle which must be passed to stopKernel()
+             */
+            cuplaEvent_t startKernel(cuplaStream_t stream)
+            {
+                cuplaEvent_t startEvent;
+                CUDA_CHECK(cuplaEventCreate(&startEvent));
+                CUDA_CHECK(cuplaEventRecord(startEvent, stream));
+                return startEvent;
+            }
+
+            /** record the end of a kernel
+             *
+             * @param kernelName (mangled) type name of the kernel functor
+             * @param startEvent event returned by startKernel()
+             * @param stream stream the kernel is enqueued into
+             */
+            void stopKernel(std::string const& kernelName, cuplaEvent_t startEvent, cuplaStream_t stream)
+            {
+                cuplaEvent_t stopEvent;
+                CUDA_CHECK(cuplaEventCreate(&stopEvent));
+                CUDA_CHECK(cuplaEventRecord(stopEvent, stream));
+                pendingKernels.push_back(PendingKernel{getKey(kernelName), startEvent, stopEvent});
+
+                // limit the number of alive events
+                if(pendingKernels.size() >= maxPendingKernels)
+                    resolveKernels();
+            }
+
+            /** record the start of a task
+             *
+             * @param taskId id of the task
+             * @param description description of the task, the first word is used as name
+             */
+            void startTask(id_t const taskId, std::string const& description)
+            {
+                std::string const name = description.substr(0, description.find_first_of(" /"));
+                runningTasks[taskId] = RunningTask{getKey(name), Clock::now()};
+            }
+
+            //! record the end of a task, tasks started while the profiler was disabled are ignored
+            void stopTask(id_t const taskId)
+            {
+                auto it = runningTasks.find(taskId);
+                if(it == runningTasks.end())
+                    return;
+                Statistics& stats = statistics[it->second.key];
+                ++stats.calls;
+                stats.time += std::chrono::duration<double>(Clock::now() - it->second.start).count();
+                runningTasks.erase(it);
+            }
+
+            /** account moved bytes to the current stage
+             *
+             * @param name name of the kernel or task moving the data
+             * @param numBytes number of bytes
+             */
+            void addBytes(std::string const& name, uint64_t const numBytes)
+            {
+                statistics[getKey(name)].bytes += numBytes;
+            }
+
+            /** get all measurements since the last call and reset them
+             *
+             * Waits until all recorded kernels are finished.
+             * Tasks which are not finished yet are accounted in a later call.
+             */
+            StatisticsMap collect()
+            {
+                resolveKernels();
+                StatisticsMap result;
+                std::swap(result, statistics);
+                return result;
+            }
+
+        private:
+            using Clock = std::chrono::steady_clock;
+
+            struct PendingKernel
+            {
+                std::string key;
+                cuplaEvent_t start;
+                cuplaEvent_t stop;
+            };
+
+            struct RunningTask
+            {
+                std::string key;
+                Clock::time_point start;
+            };
+
+            static constexpr size_t maxPendingKernels = 1024u;
+
+            Profiler() = default;
+
+            /** create the key of a measurement
+             *
+             * Names of kernels are demangled and template arguments are removed.
+             */
+            std::string getKey(std::string const& name)
+            {
+                auto it = shortNames.find(name);
+                if(it == shortNames.end())
+                {
+                    std::string const demangled = boost::core::demangle(name.c_str());
+                    it = shortNames.emplace(name, demangled.substr(0, demangled.find('<'))).first;
+                }
+                return getStage() + std::string("/") + it->second;
+            }
+
+            //! wait for all recorded kernels and accumulate their time
+            void resolveKernels()
+            {
+                for(auto& kernel : pendingKernels)
+                {
+                    CUDA_CHECK(cuplaEventSynchronize(kernel.stop));
+                    float timeMs = 0.0f;
+                    CUDA_CHECK(cuplaEventElapsedTime(&timeMs, kernel.start, kernel.stop));
+                    Statistics& stats = statistics[kernel.key];
+                    ++stats.calls;
+                    stats.time += static_cast<double>(timeMs) * 1.0e-3;
+                    CUDA_CHECK(cuplaEventDestroy(kernel.start));
+                    CUDA_CHECK(cuplaEventDestroy(kernel.stop));
+                }
+                pendingKernels.clear();
+            }
+
+            bool enabled = false;
+            std::vector<std::string> stages;
+            std::vector<PendingKernel> pendingKernels;
+            std::map<id_t, RunningTask> runningTasks;
+            StatisticsMap statistics;
+            //! cache of demangled names without template arguments
+            std::map<std::string, std::string> shortNames;
+        };
+
+        /** tag all kernels and tasks started within the scope with a stage name
+         *
+         * Nested stages are joined with a dot, e.g. `particlePush.e`.
+         * If the profiler is disabled the name is not converted to a string and no stage is entered.
+         */
+        class ScopedStage
+        {
+        public:
+            template<typename T_Name>
+            ScopedStage(T_Name const& name) : isEntered(Profiler::get().isEnabled())
+            {
+                if(isEntered)
+                    Profiler::get().enterStage(name);
+            }
+
+            ~ScopedStage()
+            {
+                // the profiler can be enabled or disabled within the scope
+                if(isEntered)
+                    Profiler::get().leaveStage();
+            }
+
+            ScopedStage(ScopedStage const&) = delete;
+            ScopedStage& operator=(ScopedStage const&) = delete;
+
+        private:
+            bool const isEntered;
+        };
+
+    } // namespace profiling
+} // namespace pmacc
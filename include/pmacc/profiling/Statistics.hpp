@@ -0,0 +1,48 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+
+
+namespace pmacc
+{
+    namespace profiling
+    {
+        //! accumulated measurements of a kernel or task within a stage
+        struct Statistics
+        {
+            //! number of kernel launches or finished tasks
+            uint64_t calls = 0u;
+            //! accumulated time in seconds
+            double time = 0.0;
+            //! accumulated number of bytes moved
+            uint64_t bytes = 0u;
+        };
+
+        //! measurements keyed by `<stage>/<name>`
+        using StatisticsMap = std::map<std::string, Statistics>;
+
+    } // namespace profiling
+} // namespace pmacc
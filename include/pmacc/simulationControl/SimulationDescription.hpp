@@ -99,6 +99,28 @@ namespace pmacc
                 currentStep = setCurrentStep;
             }
 
+            /** Check if checkpoints written to node-local directories can be merged into one directory
+             *
+             * This requires that the checkpoint backend writes separate files per node.
+             *
+             * @return true if the checkpoints of several nodes can be merged
+             */
+            bool isNodeLocalCheckpointMergeable()
+            {
+                return nodeLocalCheckpointMergeable;
+            }
+
+            /** Set if checkpoints written to node-local directories can be merged
+             *
+             * @see isNodeLocalCheckpointMergeable
+             *
+             * @param[in] bool isMergeable
+             */
+            void setNodeLocalCheckpointMergeable(const bool isMergeable)
+            {
+                nodeLocalCheckpointMergeable = isMergeable;
+            }
+
         protected:
             /** author that runs the simulation */
             std::string author;
@@ -109,6 +131,9 @@ namespace pmacc
             /** current time step of simulation */
             uint32_t currentStep{0};
 
+            /** checkpoint backend writes separate files per node */
+            bool nodeLocalCheckpointMergeable{true};
+
         private:
             friend struct detail::Environment;
 
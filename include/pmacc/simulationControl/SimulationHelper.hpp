@@ -31,16 +31,22 @@
 #include "pmacc/pluginSystem/IPlugin.hpp"
 #include "pmacc/pluginSystem/containsStep.hpp"
 #include "pmacc/pluginSystem/toTimeSlice.hpp"
+#include "pmacc/profiling/Profiler.hpp"
 #include "pmacc/simulationControl/signal.hpp"
 #include "pmacc/types.hpp"
 
 #include <boost/filesystem.hpp>
 
+#include <chrono>
 #include <csignal>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
 #include <string>
+#include <thread>
 #include <vector>
 
 
@@ -133,7 +139,10 @@ namespace pmacc
          */
         void notifyPlugins(uint32_t currentStep)
         {
-            Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
+            {
+                profiling::ScopedStage profilingStage("plugins");
+                Environment<DIM>::get().PluginConnector().notifyPlugins(currentStep);
+            }
             /* Handle signals after we executed the plugins but before checkpointing, this will result into lower
              * response latency if we have long running plugins
              */
@@ -148,9 +157,13 @@ namespace pmacc
          */
         virtual void dumpOneStep(uint32_t currentStep)
         {
+            // record a checkpoint as soon as it is drained from the node-local directory
+            progressCheckpointDrain(false);
+
             /* trigger checkpoint notification */
             if(!checkpointPeriod.empty() && pluginSystem::containsStep(seqCheckpointPeriod, currentStep))
             {
+                profiling::ScopedStage profilingStage("checkpoint");
                 /* first synchronize: if something failed, we can spare the time
                  * for the checkpoint writing */
                 CUDA_CHECK(cuplaDeviceSynchronize());
@@ -170,7 +183,17 @@ namespace pmacc
                     Environment<DIM>::get().Filesystem().createDirectoryWithPermissions(checkpointDirectory);
                 }
 
-                Environment<DIM>::get().PluginConnector().checkpointPlugins(currentStep, checkpointDirectory);
+                bool const useLocalDirectory = !checkpointLocalDirectory.empty();
+                std::string writeDirectory = checkpointDirectory;
+                if(useLocalDirectory)
+                {
+                    // the node-local storage holds one checkpoint at a time
+                    progressCheckpointDrain(true);
+                    writeDirectory = checkpointLocalDirectory + "/step_" + std::to_string(currentStep);
+                    Environment<DIM>::get().Filesystem().createDirectory(writeDirectory);
+                }
+
+                Environment<DIM>::get().PluginConnector().checkpointPlugins(currentStep, writeDirectory);
 
                 /* important synchronize: only if no errors occured until this
                  * point guarantees that a checkpoint is usable */
@@ -180,14 +203,25 @@ namespace pmacc
                 /* avoid deadlock between not finished PMacc tasks and MPI_Barrier */
                 __getTransactionEvent().waitForFinished();
 
-                /* \todo in an ideal world with MPI-3, this would be an
-                 * MPI_Ibarrier call and this function would return a MPI_Request
-                 * that could be checked */
-                MPI_CHECK(MPI_Barrier(gc.getCommunicator().getMPIComm()));
-
-                if(gc.getGlobalRank() == 0)
+                if(useLocalDirectory)
+                {
+                    /* the ranks of a node must have finished writing before the node drains its directory,
+                     * the checkpoint is recorded after the drain finished on all nodes
+                     */
+                    MPI_CHECK(MPI_Barrier(nodeComm));
+                    startCheckpointDrain(currentStep, writeDirectory);
+                }
+                else
                 {
-                    writeCheckpointStep(currentStep);
+                    /* \todo in an ideal world with MPI-3, this would be an
+                     * MPI_Ibarrier call and this function would return a MPI_Request
+                     * that could be checked */
+                    MPI_CHECK(MPI_Barrier(gc.getCommunicator().getMPIComm()));
+
+                    if(gc.getGlobalRank() == 0)
+                    {
+                        writeCheckpointStep(currentStep);
+                    }
                 }
                 numCheckpoints++;
             }
@@ -233,6 +267,9 @@ namespace pmacc
             // translate checkpointPeriod string into checkpoint intervals
             seqCheckpointPeriod = pluginSystem::toTimeSlice(checkpointPeriod);
 
+            if(!checkpointLocalDirectory.empty())
+                initCheckpointDrain();
+
             for(uint32_t nthSoftRestart = 0; nthSoftRestart <= softRestarts; ++nthSoftRestart)
             {
                 resetAll(0);
@@ -299,6 +336,7 @@ namespace pmacc
 
                 // simulatation end
                 Environment<>::get().Manager().waitForAllTasks();
+                progressCheckpointDrain(true);
 
                 tSimCalculation.toggleEnd();
 
@@ -310,6 +348,12 @@ namespace pmacc
                 }
 
             } // softRestarts loop
+
+            if(drainComm != MPI_COMM_NULL)
+            {
+                MPI_CHECK(MPI_Comm_free(&drainComm));
+                MPI_CHECK(MPI_Comm_free(&nodeComm));
+            }
         }
 
         void pluginRegisterHelp(po::options_description& desc) override
@@ -334,10 +378,14 @@ namespace pmacc
                  "Period for checkpoint creation")
                 ("checkpoint.directory", po::value<std::string>(&checkpointDirectory)->default_value(checkpointDirectory),
                  "Directory for checkpoints")
+                ("checkpoint.localDirectory", po::value<std::string>(&checkpointLocalDirectory),
+                 "Node-local directory (e.g. tmpfs or NVMe) to write checkpoints to, they are moved to "
+                 "checkpoint.directory in the background while the simulation continues")
                 ("author", po::value<std::string>(&author)->default_value(std::string("")),
                  "The author that runs the simulation and is responsible for created output files")
                 ("mpiDirect", po::value<bool>(&useMpiDirect)->zero_tokens(),
-                 "use device direct for MPI communication e.g. GPU direct");
+                 "use device direct for MPI communication e.g. GPU direct, always used if the accelerator has no "
+                 "own device memory");
             // clang-format on
         }
 
@@ -388,6 +436,10 @@ namespace pmacc
         /* common directory for checkpoints */
         std::string checkpointDirectory;
 
+        /* node-local directory checkpoints are written to before they are drained to checkpointDirectory,
+         * empty if checkpoints are written to checkpointDirectory directly */
+        std::string checkpointLocalDirectory;
+
         /* number of checkpoints written */
         uint32_t numCheckpoints{0};
 
@@ -421,6 +473,152 @@ namespace pmacc
         bool signalCreateCheckpoint = false;
         bool signalStopSimulation = false;
 
+        /** Step of the checkpoint drained from the node-local directory, -1 if no drain is pending */
+        int32_t drainedCheckpointStep = -1;
+        /** Background copy of the node-local checkpoint directory, only valid on the node leader */
+        std::future<void> checkpointDrain;
+        /** Completes after the drain finished on all ranks, reduces localDrainFailed into anyDrainFailed */
+        MPI_Request drainBarrier = MPI_REQUEST_NULL;
+        /** Failure of the drain of this rank, only set on the node leader */
+        std::exception_ptr drainFailure;
+        /** 1 if the drain of this rank failed, send buffer of drainBarrier */
+        int localDrainFailed = 0;
+        /** 1 if the drain failed on any rank, receive buffer of drainBarrier */
+        int anyDrainFailed = 0;
+        /** Communicator for drainBarrier, independent of the simulation communication */
+        MPI_Comm drainComm = MPI_COMM_NULL;
+        /** Ranks sharing the node-local directory */
+        MPI_Comm nodeComm = MPI_COMM_NULL;
+
+        /** Create the communicators for draining node-local checkpoints
+         *
+         * Throws if the checkpoints of several nodes can not be merged into one directory because the
+         * checkpoint backend writes files shared by all ranks, e.g. HDF5.
+         */
+        void initCheckpointDrain()
+        {
+            GridController<DIM>& gc = getGridController();
+            MPI_Comm const comm = gc.getCommunicator().getMPIComm();
+            MPI_CHECK(MPI_Comm_dup(comm, &drainComm));
+            MPI_CHECK(
+                MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, gc.getGlobalRank(), MPI_INFO_NULL, &nodeComm));
+
+            int nodeRank = 0;
+            MPI_CHECK(MPI_Comm_rank(nodeComm, &nodeRank));
+            int isNodeLeader = nodeRank == 0 ? 1 : 0;
+            int numNodes = 0;
+            MPI_CHECK(MPI_Allreduce(&isNodeLeader, &numNodes, 1, MPI_INT, MPI_SUM, comm));
+
+            if(numNodes > 1 && !Environment<>::get().SimulationDescription().isNodeLocalCheckpointMergeable())
+                throw std::runtime_error(
+                    "checkpoint.localDirectory: the checkpoint backend writes files shared by all ranks (e.g. "
+                    "HDF5), node-local checkpoints of " + std::to_string(numNodes) + " nodes can not be merged. "
+                    "Use a backend writing separate files per node (e.g. ADIOS2) or disable the option.");
+        }
+
+        /** Start moving a checkpoint from the node-local directory to checkpointDirectory
+         *
+         * The first rank of each node copies the directory on a background thread.
+         *
+         * @param checkpointStep step of the checkpoint
+         * @param localDirectory node-local directory containing the checkpoint
+         */
+        void startCheckpointDrain(uint32_t const checkpointStep, std::string const& localDirectory)
+        {
+            int nodeRank = 0;
+            MPI_CHECK(MPI_Comm_rank(nodeComm, &nodeRank));
+            if(nodeRank == 0)
+            {
+                checkpointDrain = std::async(
+                    std::launch::async,
+                    [localDirectory, directory = checkpointDirectory]() {
+                        bfs::path const source(localDirectory);
+                        for(bfs::recursive_directory_iterator it(source), end; it != end; ++it)
+                        {
+                            bfs::path const destination = bfs::path(directory) / bfs::relative(it->path(), source);
+                            if(bfs::is_directory(it->status()))
+                                bfs::create_directories(destination);
+                            else
+                            {
+                                bfs::remove(destination);
+                                bfs::copy_file(it->path(), destination);
+                            }
+                        }
+                        bfs::remove_all(source);
+                    });
+            }
+            drainedCheckpointStep = static_cast<int32_t>(checkpointStep);
+        }
+
+        /** Progress the drain of the last checkpoint written to the node-local directory
+         *
+         * The checkpoint is appended to the checkpoint master file after the drain finished on all ranks.
+         * Must be called by all ranks in the same order if waitForDrain is true.
+         *
+         * @param waitForDrain block until the checkpoint is drained and recorded
+         */
+        void progressCheckpointDrain(bool const waitForDrain)
+        {
+            if(drainedCheckpointStep < 0)
+                return;
+
+            if(drainBarrier == MPI_REQUEST_NULL)
+            {
+                drainFailure = nullptr;
+                if(checkpointDrain.valid())
+                {
+                    if(!waitForDrain
+                       && checkpointDrain.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+                        return;
+                    try
+                    {
+                        checkpointDrain.get();
+                    }
+                    catch(...)
+                    {
+                        // rethrown after all ranks know about the failure
+                        drainFailure = std::current_exception();
+                    }
+                }
+                // the reduction completes after the drain finished on all ranks and shares failures
+                localDrainFailed = drainFailure ? 1 : 0;
+                MPI_CHECK(MPI_Iallreduce(
+                    &localDrainFailed,
+                    &anyDrainFailed,
+                    1,
+                    MPI_INT,
+                    MPI_MAX,
+                    drainComm,
+                    &drainBarrier));
+            }
+
+            int isDrained = 0;
+            if(waitForDrain)
+            {
+                MPI_CHECK(MPI_Wait(&drainBarrier, MPI_STATUS_IGNORE));
+                isDrained = 1;
+            }
+            else
+                MPI_CHECK(MPI_Test(&drainBarrier, &isDrained, MPI_STATUS_IGNORE));
+
+            if(isDrained != 0)
+            {
+                uint32_t const checkpointStep = static_cast<uint32_t>(drainedCheckpointStep);
+                drainedCheckpointStep = -1;
+                if(anyDrainFailed != 0)
+                {
+                    // the checkpoint is incomplete and not recorded, all ranks abort
+                    if(drainFailure)
+                        std::rethrow_exception(drainFailure);
+                    throw std::runtime_error(
+                        "Moving checkpoint " + std::to_string(checkpointStep)
+                        + " from the node-local directory failed on another node");
+                }
+                if(getGridController().getGlobalRank() == 0)
+                    writeCheckpointStep(checkpointStep);
+            }
+        }
+
         void checkSignals(uint32_t const currentStep)
         {
             /* Avoid signal handling if the last signal is still processed.
@@ -0,0 +1,129 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/communicationUT.cpp" */
+
+
+namespace pmacc
+{
+    namespace test
+    {
+        namespace communication
+        {
+            namespace GridBuffer
+            {
+                /**
+                 * Checks that the guard of a periodic single rank domain holds the values of the opposite border
+                 * after the exchange in all directions.
+                 *
+                 * The test runs with and without PMACC_EXCHANGE_AGGREGATION, the expected values are the same.
+                 */
+                struct CommunicationTest
+                {
+                    template<unsigned T_dim>
+                    void exec(::pmacc::DataSpace<T_dim> const& localSize, uint32_t const communicationTag)
+                    {
+                        using Data = uint64_t;
+
+                        ::pmacc::DataSpace<T_dim> const guard = ::pmacc::DataSpace<T_dim>::create(1);
+                        ::pmacc::GridBuffer<Data, T_dim> gridBuffer(::pmacc::GridLayout<T_dim>(localSize, guard));
+                        for(uint32_t ex = 1u; ex < ::pmacc::traits::NumberOfExchanges<T_dim>::value; ++ex)
+                            gridBuffer.addExchange(::pmacc::GUARD, ex, guard, communicationTag);
+
+                        ::pmacc::DataSpace<T_dim> const fullSize = localSize + guard + guard;
+                        auto const numCells = static_cast<uint32_t>(fullSize.productOfComponents());
+
+                        // cells in the guard are zero, other cells hold their linear index within the local domain
+                        auto hostBox = gridBuffer.getHostBuffer().getDataBox();
+                        for(uint32_t i = 0u; i < numCells; ++i)
+                        {
+                            ::pmacc::DataSpace<T_dim> const cellIdx
+                                = ::pmacc::DataSpaceOperations<T_dim>::map(fullSize, i);
+                            hostBox(cellIdx) = isGuard(cellIdx, localSize, guard)
+                                ? Data(0u)
+                                : getExpectedValue<Data>(cellIdx, localSize, guard);
+                        }
+
+                        gridBuffer.hostToDevice();
+                        gridBuffer.communication();
+                        gridBuffer.getHostBuffer().reset(false);
+                        gridBuffer.deviceToHost();
+
+                        hostBox = gridBuffer.getHostBuffer().getDataBox();
+                        for(uint32_t i = 0u; i < numCells; ++i)
+                        {
+                            ::pmacc::DataSpace<T_dim> const cellIdx
+                                = ::pmacc::DataSpaceOperations<T_dim>::map(fullSize, i);
+                            REQUIRE(hostBox(cellIdx) == getExpectedValue<Data>(cellIdx, localSize, guard));
+                        }
+                    }
+
+                private:
+                    template<unsigned T_dim>
+                    static bool isGuard(
+                        ::pmacc::DataSpace<T_dim> const& cellIdx,
+                        ::pmacc::DataSpace<T_dim> const& localSize,
+                        ::pmacc::DataSpace<T_dim> const& guard)
+                    {
+                        for(uint32_t d = 0u; d < T_dim; ++d)
+                            if(cellIdx[d] < guard[d] || cellIdx[d] >= guard[d] + localSize[d])
+                                return true;
+                        return false;
+                    }
+
+                    //! linear index + 1 of the periodic image of a cell within the local domain
+                    template<typename T_Data, unsigned T_dim>
+                    static T_Data getExpectedValue(
+                        ::pmacc::DataSpace<T_dim> const& cellIdx,
+                        ::pmacc::DataSpace<T_dim> const& localSize,
+                        ::pmacc::DataSpace<T_dim> const& guard)
+                    {
+                        ::pmacc::DataSpace<T_dim> localIdx;
+                        for(uint32_t d = 0u; d < T_dim; ++d)
+                            localIdx[d] = (cellIdx[d] - guard[d] + localSize[d]) % localSize[d];
+                        return static_cast<T_Data>(::pmacc::DataSpaceOperations<T_dim>::map(localSize, localIdx)) + 1u;
+                    }
+                };
+
+            } // namespace GridBuffer
+        } // namespace communication
+    } // namespace test
+} // namespace pmacc
+
+TEST_CASE("GridBuffer::communication", "[communication]")
+{
+    using namespace pmacc::test::communication::GridBuffer;
+
+    getFixture();
+
+    // all exchanges are small enough to be packed into the aggregated message
+    CommunicationTest{}.exec(pmacc::DataSpace<TEST_DIM>::create(8), 1u);
+
+    // the exchanges of the last dimension are larger than the aggregation limit and are sent directly
+    pmacc::DataSpace<TEST_DIM> largeSize = pmacc::DataSpace<TEST_DIM>::create(96);
+    largeSize[TEST_DIM - 1] = 8;
+#if TEST_DIM == 2
+    largeSize[0] = 9216;
+#endif
+    CommunicationTest{}.exec(largeSize, 2u);
+}
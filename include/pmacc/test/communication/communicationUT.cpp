@@ -0,0 +1,55 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <pmacc/boost_workaround.hpp>
+
+#include <pmacc/test/PMaccFixture.hpp>
+
+#include <cstdint>
+
+#include <catch2/catch.hpp>
+
+#include <pmacc/dimensions/DataSpace.hpp>
+#include <pmacc/dimensions/DataSpaceOperations.hpp>
+#include <pmacc/dimensions/GridLayout.hpp>
+#include <pmacc/memory/buffers/GridBuffer.hpp>
+#include <pmacc/traits/NumberOfExchanges.hpp>
+
+
+/*******************************************************************************
+ * Test Suites
+ ******************************************************************************/
+using MyPMaccFixture = pmacc::test::PMaccFixture<TEST_DIM>;
+
+/** Initialize PMacc on first use
+ *
+ * The communicator of the GridController is a static member of a class template and is therefore initialized
+ * in an unspecified order relative to namespace scope objects of this file. A namespace scope fixture can run
+ * initDevices() before the communicator is constructed, which resets the neighbor mask afterwards and disables
+ * all exchanges.
+ */
+static MyPMaccFixture& getFixture()
+{
+    static MyPMaccFixture fixture;
+    return fixture;
+}
+
+#include "GridBuffer/communication.hpp"
@@ -0,0 +1,94 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+/* #includes in "test/memoryUT.cu" */
+
+
+namespace pmacc
+{
+    namespace test
+    {
+        namespace memory
+        {
+            namespace DeviceBufferIntern
+            {
+                /**
+                 * Checks if a deep copy owns its memory and keeps the
+                 * data when the source buffer is changed.
+                 */
+                struct MakeDeepCopyTest
+                {
+                    template<typename T_Dim>
+                    void exec(T_Dim)
+                    {
+                        using Data = uint8_t;
+
+                        using ::pmacc::test::memory::getElementsPerDim;
+
+                        std::vector<size_t> nElementsPerDim = getElementsPerDim<T_Dim>();
+
+                        for(unsigned i = 0; i < nElementsPerDim.size(); ++i)
+                        {
+                            ::pmacc::DataSpace<T_Dim::value> const dataSpace
+                                = ::pmacc::DataSpace<T_Dim::value>::create(nElementsPerDim[i]);
+                            ::pmacc::HostBufferIntern<Data, T_Dim::value> hostBufferIntern(dataSpace);
+                            ::pmacc::DeviceBufferIntern<Data, T_Dim::value> deviceBufferIntern(dataSpace);
+
+                            for(size_t i = 0; i < static_cast<size_t>(dataSpace.productOfComponents()); ++i)
+                            {
+                                hostBufferIntern.getPointer()[i] = static_cast<Data>(i);
+                            }
+
+                            deviceBufferIntern.copyFrom(hostBufferIntern);
+                            auto deepCopy = ::pmacc::makeDeepCopy(deviceBufferIntern);
+                            REQUIRE(deepCopy->getPointer() != deviceBufferIntern.getPointer());
+
+                            deviceBufferIntern.setValue(static_cast<Data>(0));
+                            hostBufferIntern.reset();
+                            hostBufferIntern.copyFrom(*deepCopy);
+
+                            for(size_t i = 0; i < static_cast<size_t>(dataSpace.productOfComponents()); ++i)
+                            {
+                                REQUIRE(hostBufferIntern.getPointer()[i] == static_cast<Data>(i));
+                            }
+                        }
+                    }
+
+                    PMACC_NO_NVCC_HDWARNING
+                    template<typename T_Dim>
+                    HDINLINE void operator()(T_Dim dim)
+                    {
+                        exec(dim);
+                    }
+                };
+
+            } // namespace DeviceBufferIntern
+        } // namespace memory
+    } // namespace test
+} // namespace pmacc
+
+TEST_CASE("DeviceBufferIntern::makeDeepCopy", "[makeDeepCopy]")
+{
+    using namespace pmacc::test::memory::DeviceBufferIntern;
+    ::boost::mpl::for_each<Dims>(MakeDeepCopyTest());
+}
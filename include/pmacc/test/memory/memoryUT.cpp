@@ -104,6 +104,7 @@ using MyPMaccFixture = pmacc::test::PMaccFixture<TEST_DIM>;
 
 static MyPMaccFixture fixture;
 
+#include "DeviceBufferIntern/makeDeepCopy.hpp"
 #include "HostBufferIntern/copyFrom.hpp"
 #include "HostBufferIntern/reset.hpp"
 #include "HostBufferIntern/setValue.hpp"
@@ -0,0 +1,67 @@
+/* Copyright 2026 agent
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <cstddef>
+
+
+namespace pmacc
+{
+    namespace traits
+    {
+        /** Get the shared memory a kernel can allocate statically per block
+         *
+         * @tparam T_Acc the accelerator type
+         * @return @p ::value number of bytes
+         */
+        template<typename T_Acc = cupla::AccThreadSeq>
+        struct GetMaxStaticSharedMemBytes
+        {
+            //! limit of statically allocated shared memory on GPUs
+            static constexpr size_t value = 48u * 1024u;
+        };
+
+#if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetMaxStaticSharedMemBytes<alpaka::AccCpuOmp2Blocks<T_Args...>>
+        {
+            static constexpr size_t value = ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB * 1024u;
+        };
+#endif
+#if(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetMaxStaticSharedMemBytes<alpaka::AccCpuSerial<T_Args...>>
+        {
+            static constexpr size_t value = ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB * 1024u;
+        };
+#endif
+#if(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetMaxStaticSharedMemBytes<alpaka::AccCpuTbbBlocks<T_Args...>>
+        {
+            static constexpr size_t value = ALPAKA_BLOCK_SHARED_DYN_MEMBER_ALLOC_KIB * 1024u;
+        };
+#endif
+    } // namespace traits
+} // namespace pmacc
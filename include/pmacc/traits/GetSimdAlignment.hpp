@@ -0,0 +1,74 @@
+/* Copyright 2021 PMacc contributors
+ *
+ * This file is part of PMacc.
+ *
+ * PMacc is free software: you can redistribute it and/or modify
+ * it under the terms of either the GNU General Public License or
+ * the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * PMacc is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License and the GNU Lesser General Public License
+ * for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * and the GNU Lesser General Public License along with PMacc.
+ * If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#pragma once
+
+#include "pmacc/types.hpp"
+
+#include <alpaka/core/Vectorize.hpp>
+
+#include <cstdint>
+
+
+namespace pmacc
+{
+    namespace traits
+    {
+        /** Get the alignment in bytes for data processed with SIMD instructions
+         *
+         * Used to align the attribute arrays of particle frames.
+         * The alignment is only larger than one if PMacc is compiled with PMACC_SIMD_FRAME_LAYOUT enabled and
+         * the accelerator is a CPU accelerator, otherwise the natural alignment of the data is used.
+         *
+         * @tparam T_Acc the accelerator type
+         * @return @p ::value alignment in bytes
+         */
+        template<typename T_Acc = cupla::AccThreadSeq>
+        struct GetSimdAlignment
+        {
+            static constexpr uint32_t value = 1u;
+        };
+
+#if(PMACC_SIMD_FRAME_LAYOUT == 1)
+#    if(ALPAKA_ACC_CPU_B_OMP2_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetSimdAlignment<alpaka::AccCpuOmp2Blocks<T_Args...>>
+        {
+            static constexpr uint32_t value = alpaka::core::vectorization::defaultAlignment;
+        };
+#    endif
+#    if(ALPAKA_ACC_CPU_B_SEQ_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetSimdAlignment<alpaka::AccCpuSerial<T_Args...>>
+        {
+            static constexpr uint32_t value = alpaka::core::vectorization::defaultAlignment;
+        };
+#    endif
+#    if(ALPAKA_ACC_CPU_B_TBB_T_SEQ_ENABLED == 1)
+        template<typename... T_Args>
+        struct GetSimdAlignment<alpaka::AccCpuTbbBlocks<T_Args...>>
+        {
+            static constexpr uint32_t value = alpaka::core::vectorization::defaultAlignment;
+        };
+#    endif
+#endif
+    } // namespace traits
+} // namespace pmacc
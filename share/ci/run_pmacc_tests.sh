@@ -112,3 +112,11 @@ make
 if [ "${PIC_BACKEND}" != "hip" ] ; then
   ctest -V
 fi
+
+# rerun the tests with aggregated exchange messages, the results must not differ
+cmake $CMAKE_ARGS -DPMACC_EXCHANGE_AGGREGATION=ON $code_DIR/include/pmacc
+make
+
+if [ "${PIC_BACKEND}" != "hip" ] ; then
+  ctest -V
+fi
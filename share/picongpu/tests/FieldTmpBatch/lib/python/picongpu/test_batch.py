@@ -0,0 +1,46 @@
+from os.path import join
+import numpy as np
+import openpmd_api as api
+
+
+def load_fields(simulation_path, file_name, field_names):
+    path_output = join(simulation_path, 'simOutput/openPMD', file_name + '_%T.h5')
+    series = api.Series(path_output, api.Access_Type.read_only)
+    fields = {}
+    for iteration_id, iteration in series.iterations.items():
+        for name in field_names:
+            record = iteration.meshes[name][api.Mesh_Record_Component.SCALAR]
+            fields[(iteration_id, name)] = record.load_chunk()
+        series.flush()
+    return fields
+
+
+def main():
+    simulation_path = '../../../../'
+    solver_names = ['chargeDensity', 'energyDensity',
+                    'particleMomentumComponent']
+    field_names = ['e_all_' + solver for solver in solver_names]
+
+    batch = load_fields(simulation_path, 'batch', field_names)
+
+    passed = len(batch) != 0
+    for solver, name in zip(solver_names, field_names):
+        single = load_fields(simulation_path, solver, [name])
+        for key, reference in single.items():
+            # relative to the largest value, cells with tiny values differ
+            # only by the order of the atomic additions
+            scale = max(np.max(np.abs(reference)), np.finfo(np.float32).tiny)
+            deviation = np.max(np.abs(batch[key] - reference)) / scale
+            is_close = deviation <= 1.0e-5
+            passed = passed and is_close
+            print("iteration {} {}: relative deviation {:e} {}".format(
+                key[0], name, deviation, "ok" if is_close else "FAILED"))
+
+    if passed:
+        print("All tests passed.")
+    else:
+        print("Some tests didn't pass.")
+
+
+if __name__ == '__main__':
+    main()
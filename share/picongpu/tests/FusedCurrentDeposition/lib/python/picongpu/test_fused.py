@@ -0,0 +1,64 @@
+import sys
+from os.path import join
+import numpy as np
+
+
+def load_energies(simulation_path, file_name):
+    data = np.loadtxt(join(simulation_path, 'simOutput', file_name + '.dat'),
+                      ndmin=2)
+    return {int(row[0]): row[1:] for row in data}
+
+
+def is_fused(simulation_path, species):
+    # PIConGPU reports the species which deposit their current within the
+    # push, without this the test would compare two separate depositions
+    message = "particlePush: species {} deposits its current within the " \
+        "push".format(species)
+    with open(join(simulation_path, 'simOutput', 'output')) as output:
+        return any(message in line for line in output)
+
+
+def main():
+    # run of 1.cfg (fused) and of 1_separate.cfg (reference)
+    fused_path = '../../../../'
+    if len(sys.argv) != 2:
+        print("usage: {} <simulation path of 1_separate.cfg>".format(
+            sys.argv[0]))
+        sys.exit(1)
+    separate_path = sys.argv[1]
+
+    # the current is added with atomic operations in a different order,
+    # therefore the energies are compared with a relative tolerance
+    tolerance = 1.0e-5
+
+    passed = True
+    for species in ['e', 'i']:
+        fused = is_fused(fused_path, species)
+        passed = passed and fused
+        print("species {} fused: {}".format(species, fused))
+
+    for file_name in ['fields_energy', 'e_energy_all', 'i_energy_all']:
+        fused = load_energies(fused_path, file_name)
+        separate = load_energies(separate_path, file_name)
+        passed = passed and len(fused) != 0 and \
+            fused.keys() == separate.keys()
+        for step in sorted(fused.keys() & separate.keys()):
+            # the first column is the total energy of the fields or the
+            # kinetic energy of the particles
+            reference = separate[step][0]
+            deviation = abs(fused[step][0] - reference) / \
+                max(abs(reference), np.finfo(np.float64).tiny)
+            is_close = deviation <= tolerance
+            passed = passed and is_close
+            print("step {} {}: fused {:e} separate {:e}, relative deviation "
+                  "{:e} {}".format(step, file_name, fused[step][0], reference,
+                                   deviation, "ok" if is_close else "FAILED"))
+
+    if passed:
+        print("All tests passed.")
+    else:
+        print("Some tests didn't pass.")
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,57 @@
+import sys
+from os.path import join
+import numpy as np
+
+
+def load_count(simulation_path, species):
+    file_name = species + '_macroParticlesCount.dat'
+    data = np.loadtxt(join(simulation_path, 'simOutput', file_name),
+                      ndmin=2)
+    return {int(step): int(count) for step, count in data[:, :2]}
+
+
+def main():
+    # run of 1.cfg (merged) and of 1_separate.cfg (reference)
+    merged_path = '../../../../'
+    if len(sys.argv) != 2:
+        print("usage: {} <simulation path of 1_separate.cfg>".format(
+            sys.argv[0]))
+        sys.exit(1)
+    separate_path = sys.argv[1]
+
+    ions = (load_count(merged_path, 'i'), load_count(separate_path, 'i'))
+    electrons = (load_count(merged_path, 'e'),
+                 load_count(separate_path, 'e'))
+
+    passed = len(electrons[0]) != 0 and electrons[0].keys() == \
+        electrons[1].keys()
+    for step in sorted(electrons[0].keys() & electrons[1].keys()):
+        # ions are not created or removed, only ionized
+        same_ions = ions[0][step] == ions[1][step]
+        # each ion is ionized with a probability p in both runs, the
+        # difference of the two counts has a variance of at most
+        # 2 * sum(p) which is estimated by the sum of both counts
+        merged = electrons[0][step]
+        separate = electrons[1][step]
+        sigma = np.sqrt(max(merged + separate, 1))
+        deviation = abs(merged - separate) / sigma
+        is_close = same_ions and deviation <= 5.0
+        passed = passed and is_close
+        print("step {}: electrons merged {} separate {}, {:.2f} sigma {}"
+              "".format(step, merged, separate, deviation,
+                        "ok" if is_close else "FAILED"))
+
+    # without ionization the comparison is meaningless
+    last_step = max(electrons[0].keys(), default=0)
+    if electrons[1].get(last_step, 0) == 0:
+        print("no ions were ionized until step {}".format(last_step))
+        passed = False
+
+    if passed:
+        print("All tests passed.")
+    else:
+        print("Some tests didn't pass.")
+
+
+if __name__ == '__main__':
+    main()
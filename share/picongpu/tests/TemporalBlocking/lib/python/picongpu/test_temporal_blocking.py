@@ -0,0 +1,52 @@
+import sys
+from os.path import join
+import numpy as np
+
+
+def load_energies(simulation_path):
+    data = np.loadtxt(join(simulation_path, 'simOutput', 'fields_energy.dat'),
+                      ndmin=2)
+    return {int(row[0]): row[1:] for row in data}
+
+
+def main():
+    # run with --fieldSolver.temporalBlocking and the run of the
+    # corresponding cfg without it
+    blocking_path = '../../../../'
+    if len(sys.argv) != 2:
+        print("usage: {} <simulation path of the run without temporal "
+              "blocking>".format(sys.argv[0]))
+        sys.exit(1)
+    reference_path = sys.argv[1]
+
+    # both paths compute the same values per cell, only the order of the
+    # updates differs
+    tolerance = 1.0e-6
+    components = ['total', 'Bx', 'By', 'Bz', 'Ex', 'Ey', 'Ez']
+
+    blocking = load_energies(blocking_path)
+    reference = load_energies(reference_path)
+
+    # without any field the comparison is meaningless
+    last_step = max(reference.keys(), default=0)
+    passed = len(blocking) != 0 and blocking.keys() == reference.keys() and \
+        reference[last_step][0] > 0.0
+    # the energy of a component can be zero due to the symmetry of the source,
+    # deviations are relative to the total energy
+    for step in sorted(blocking.keys() & reference.keys()):
+        scale = max(reference[step][0], np.finfo(np.float64).tiny)
+        deviation = np.abs(blocking[step] - reference[step]) / scale
+        is_close = np.all(deviation <= tolerance)
+        passed = passed and is_close
+        print("step {}: largest relative deviation {:e} ({}) {}".format(
+            step, np.max(deviation), components[np.argmax(deviation)],
+            "ok" if is_close else "FAILED"))
+
+    if passed:
+        print("All tests passed.")
+    else:
+        print("Some tests didn't pass.")
+
+
+if __name__ == '__main__':
+    main()